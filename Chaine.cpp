@@ -1,4 +1,6 @@
 #include "BisConsole.h"
+#include <new>
+#include <typeinfo>
 #include "Chaine.h"
 
 /// <summary>
@@ -29,6 +31,40 @@ CEntite* CChaine::Cloner() const
 	return new CChaine(*this);
 }
 
+/// <summary>
+/// Permet de crer un duplicata de cette entit en lui transfrant ses ressources (dplacement), cette entit restant ensuite valide mais dans un tat indtermin
+/// <para>Une classe drive qui ne rcrit pas cette mthode est simplement clone (cf. Cloner), plutt que rduite  une CChaine</para>
+/// </summary>
+/// <returns>Objet cr dynamiquement par dplacement</returns>
+CEntite* CChaine::ClonerParDeplacement()
+{
+	if (typeid(*this) != typeid(CChaine)) return Cloner();
+	return new CChaine(static_cast<CChaine&&>(*this));
+}
+
+/// <summary>
+/// Retourne la taille en octets d'un objet de ce type d'entit (cf. ClonerDans)
+/// <para>Une classe drive qui ne rcrit pas cette mthode obtient la taille par dfaut de CEntite, la construction en place ne lui tant pas propose</para>
+/// </summary>
+/// <returns>Taille de l'objet</returns>
+long CChaine::TailleObjet() const
+{
+	if (typeid(*this) != typeid(CChaine)) return CEntite::TailleObjet();
+	return (long)sizeof(CChaine);
+}
+
+/// <summary>
+/// Permet de crer un duplicata de cette entit  l'adresse spcifie, qui dispose d'au moins TailleObjet octets (construction "en place")
+/// <para>Une classe drive qui ne rcrit pas cette mthode ne la prend pas en charge, plutt que d'tre rduite  une CChaine</para>
+/// </summary>
+/// <param name="adresse">Adresse de l'emplacement o construire le duplicata</param>
+/// <returns>Objet cr par clonage  cette adresse, sinon NULL (classe drive)</returns>
+CEntite* CChaine::ClonerDans(void* adresse) const
+{
+	if (typeid(*this) != typeid(CChaine)) return NULL;
+	return new (adresse) CChaine(*this);
+}
+
 /// <summary>
 /// Indique si les donnes de cette entit sont valides
 /// </summary>
@@ -51,6 +87,108 @@ int CChaine::Comparer(const CEntite& autreEntite, char modaliteComparaison) cons
 	return Comparer(((const CChaine&)autreEntite).m_Adresse, modaliteComparaison);
 }
 
+/// <summary>
+/// Calcule une valeur de hachage de cette entit, compatible avec la modalit de comparaison spcifie
+/// <para>Deux entits gales selon cette modalit (Comparer retournant 0) doivent imprativement produire la mme valeur de hachage</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+/// <returns>Vrai si ce type d'entit prend en charge le hachage selon cette modalit de comparaison, sinon faux</returns>
+bool CChaine::Hacher(char modaliteComparaison, unsigned long& valeurHachage) const
+{
+	return HacherCle(m_Adresse, modaliteComparaison, valeurHachage);
+}
+
+/// <summary>
+/// Retourne une fonction de comparaison directe de deux chanes, quivalente  Comparer pour la modalit de comparaison spcifie
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <returns>Fonction de comparaison directe, sinon NULL (modalit inconnue)</returns>
+CEntite::ComparateurEntites CChaine::ObtenirComparateur(char modaliteComparaison) const
+{
+	switch (modaliteComparaison)
+	{
+	case CChaine::ComparaisonStricte:
+		return ComparerEntites;
+	case CChaine::ComparaisonIC:
+		return ComparerEntites_IC;
+	case CChaine::ComparaisonIA:
+		return ComparerEntites_IA;
+	case CChaine::ComparaisonICA:
+		return ComparerEntites_ICA;
+	default:
+		return NULL;
+	}
+}
+
+/// <summary>
+/// Permet d'crire la cl de tri de cette chane selon la modalit de comparaison spcifie : ses caractres ramens  leur forme canonique (cf. ObtenirTableConversion), prcds d'un octet nul, une chane vide ayant pour cl un unique octet 1 afin d'tre place aprs toute autre
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  respecter</param>
+/// <param name="tampon">Adresse du tampon recevant la cl</param>
+/// <param name="taille">Taille du tampon en octets</param>
+/// <returns>Longueur de la cl en octets (ventuellement suprieure  la taille du tampon, qui doit alors tre agrandi), sinon -1 (modalit inconnue)</returns>
+long CChaine::RepresentationOctets(char modaliteComparaison, unsigned char* tampon, long taille) const
+{
+	if ((modaliteComparaison < CChaine::ComparaisonStricte) || (modaliteComparaison > CChaine::ComparaisonICA)) return -1;
+	if (m_Longueur == 0)
+	{
+		if (taille >= 1) tampon[0] = 1;
+		return 1;
+	}
+	if (taille < m_Longueur + 1) return m_Longueur + 1;
+	// Seul le caractre nul tant converti en 0, l'octet nul initial place toute chane non vide avant la chane vide, sans modifier l'ordre des autres
+	const unsigned char* tableConversion = ObtenirTableConversion
+	(
+		(modaliteComparaison == CChaine::ComparaisonIC) || (modaliteComparaison == CChaine::ComparaisonICA),
+		(modaliteComparaison == CChaine::ComparaisonIA) || (modaliteComparaison == CChaine::ComparaisonICA)
+	);
+	tampon[0] = 0;
+	for (long indice = 0; indice < m_Longueur; indice++) tampon[indice + 1] = tableConversion[(unsigned char)m_Adresse[indice]];
+	return m_Longueur + 1;
+}
+
+/// <summary>
+/// Compare cette chane au contenu de chane spcifi, selon la modalit de comparaison spcifie, comme Comparer le ferait avec une chane de ce contenu
+/// </summary>
+/// <param name="cle">Contenu de chane auquel on compare cette chane, sinon NULL (quivalent  une chane vide)</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <param name="resultat">[RESULTAT] -1 si cette chane est "infrieure"  la cl, 1 si elle lui est "suprieure", sinon 0 (en cas d'galit)</param>
+/// <returns>Vrai si la comparaison a pu se faire, sinon faux (modalit inconnue)</returns>
+bool CChaine::ComparerACle(const char* cle, char modaliteComparaison, int& resultat) const
+{
+	resultat = 0;
+	if ((modaliteComparaison < CChaine::ComparaisonStricte) || (modaliteComparaison > CChaine::ComparaisonICA)) return false;
+	resultat = Comparer(cle, modaliteComparaison);
+	return true;
+}
+
+/// <summary>
+/// Calcule une valeur de hachage du contenu de chane spcifi, identique  celle (cf. Hacher) de toute chane gale  ce contenu selon la modalit de comparaison spcifie
+/// </summary>
+/// <param name="cle">Contenu de chane  hacher, sinon NULL (quivalent  une chane vide)</param>
+/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+/// <returns>Vrai si le hachage a pu se faire, sinon faux (modalit inconnue)</returns>
+bool CChaine::HacherCle(const char* cle, char modaliteComparaison, unsigned long& valeurHachage) const
+{
+	valeurHachage = 0;
+	if ((modaliteComparaison < CChaine::ComparaisonStricte) || (modaliteComparaison > CChaine::ComparaisonICA)) return false;
+	const unsigned char* tableConversion = ObtenirTableConversion
+	(
+		(modaliteComparaison == CChaine::ComparaisonIC) || (modaliteComparaison == CChaine::ComparaisonICA),
+		(modaliteComparaison == CChaine::ComparaisonIA) || (modaliteComparaison == CChaine::ComparaisonICA)
+	);
+	// Hachage FNV-1a de chaque caractre, pralablement ramen  sa forme canonique pour la modalit de comparaison (une chane non dfinie quivaut  une chane vide)
+	unsigned long hachage = 2166136261UL;
+	for (const char* car = cle; (car != NULL) && (*car != 0); car++)
+	{
+		hachage = (hachage ^ tableConversion[(unsigned char)*car]) * 16777619UL;
+	}
+	valeurHachage = hachage;
+	return true;
+}
+
 /// <summary>
 /// Constructeur par dfaut
 /// </summary>
@@ -69,6 +207,17 @@ CChaine::CChaine(const CChaine& source)
 	Modifier(source.m_Adresse);
 }
 
+/// <summary>
+/// Constructeur par dplacement : le contenu de la source lui est retir, sans nouvelle allocation
+/// </summary>
+/// <param name="source">Chane source de ce dplacement, qui devient vide</param>
+CChaine::CChaine(CChaine&& source)
+	:CEntite(source), m_Longueur(source.m_Longueur), m_Adresse(source.m_Adresse)
+{
+	source.m_Longueur = 0;
+	source.m_Adresse = NULL;
+}
+
 /// <summary>
 /// Constructeur spcifique
 /// </summary>
@@ -382,6 +531,16 @@ bool CChaine::EstDefinie() const
 /// </summary>
 /*static*/ const char CChaine::LettresAccentueesEnMinuscule_EnMajuscule[] = { '','','','','','','','','','','','','','','','','','','','','','','','','',0 };
 
+/// <summary>
+/// Tables de conversion des caractres, une par modalit de comparaison (cf. ObtenirTableConversion)
+/// </summary>
+/*static*/ unsigned char CChaine::TablesConversion[CChaine::ComparaisonICA + 1][256];
+
+/// <summary>
+/// Instance dont la construction statique construit les tables de conversion des caractres
+/// </summary>
+/*static*/ CChaine::CConstructionTablesConversion CChaine::ConstructionTablesConversion;
+
 /// <summary>
 /// Vrifie si le caractre spcifi est un chiffre dcimal
 /// </summary>
@@ -681,21 +840,7 @@ bool CChaine::EstDefinie() const
 /// <returns>-1 si la chane "1" est plus petite que la chane "2", 1 si la chane "1" est plus grande que la chane "2", sinon 0</returns>
 /*static*/ int CChaine::ComparerChaine(const char* chaine1, const char* chaine2, bool ignorerCasse, bool ignorerAccentuation)
 {
-	if ((chaine1 == NULL) || (*chaine1 == 0))
-	{
-		return ((chaine2 == NULL) || (*chaine2 == 0)) ? 0 : 1;
-	}
-	else if ((chaine2 == NULL) || (*chaine2 == 0)) return -1;
-	ComparateurCaracteres comparerCaracteres = ObtenirComparateurCaracteres(ignorerCasse, ignorerAccentuation);
-	while (true)
-	{
-		if (*chaine1 == 0) return (*chaine2 == 0) ? 0 : -1;
-		if (*chaine2 == 0) return 1;
-		int resultat = comparerCaracteres(*chaine1, *chaine2);
-		if (resultat != 0) return resultat;
-		chaine1++;
-		chaine2++;
-	}
+	return ComparerChaine(chaine1, chaine2, ObtenirTableConversion(ignorerCasse, ignorerAccentuation));
 }
 
 /// <summary>
@@ -989,23 +1134,112 @@ bool CChaine::EstDefinie() const
 }
 
 /// <summary>
-/// Retourne la fonction de comparaison entre deux caractres en fonction des options spcifies
+/// Retourne la table de conversion de chaque caractre vers sa forme canonique (celle que comparent les fonctions ComparerCaractere) en fonction des options spcifies
+/// <para>Les tables sont construites lors de l'initialisation statique du programme (cf. CConstructionTablesConversion) : les comparaisons de chanes (y compris par les fonctions obtenues par ObtenirComparateur) ralises lors de l'initialisation statique d'autres units de compilation peuvent donc encore trouver des tables nulles</para>
 /// </summary>
 /// <param name="ignorerCasse">Indique si la comparaison doit ignorer les diffrences de casse</param>
 /// <param name="ignorerAccentuation">Indique si la comparaison doit ignorer les diffrences d'accentuation</param>
-/// <returns>Fonction de comparaison entre deux caractres en fonction des options spcifies</returns>
-/*static*/ CChaine::ComparateurCaracteres CChaine::ObtenirComparateurCaracteres(bool ignorerCasse, bool ignorerAccentuation)
+/// <returns>Table de 256 caractres, indexe par le code (non sign) de chaque caractre</returns>
+/*static*/ const unsigned char* CChaine::ObtenirTableConversion(bool ignorerCasse, bool ignorerAccentuation)
 {
 	if (ignorerCasse)
 	{
-		return ignorerAccentuation ? ComparerCaractere_ICA : ComparerCaractere_IC;
+		return TablesConversion[ignorerAccentuation ? CChaine::ComparaisonICA : CChaine::ComparaisonIC];
 	}
 	else
 	{
-		return ignorerAccentuation ? ComparerCaractere_IA : ComparerCaractere;
+		return TablesConversion[ignorerAccentuation ? CChaine::ComparaisonIA : CChaine::ComparaisonStricte];
+	}
+}
+
+/// <summary>
+/// Constructeur par dfaut : construit les tables de conversion des caractres
+/// </summary>
+CChaine::CConstructionTablesConversion::CConstructionTablesConversion()
+{
+	// Chaque table reprend exactement la conversion opre par la fonction ComparerCaractere correspondante
+	for (int code = 0; code < 256; code++)
+	{
+		char caractere = (char)code;
+		TablesConversion[CChaine::ComparaisonStricte][code] = (unsigned char)caractere;
+		TablesConversion[CChaine::ComparaisonIC][code] = (unsigned char)CaractereEnMinuscule(caractere);
+		TablesConversion[CChaine::ComparaisonIA][code] = (unsigned char)CaractereNonAccentue(caractere);
+		// tolower n'est dfini que pour les codes non signs : les caractres au-del de 127 que CaractereNonAccentue laisse inchangs sont donc convertis au pralable
+		TablesConversion[CChaine::ComparaisonICA][code] = (unsigned char)tolower((unsigned char)CaractereNonAccentue(caractere));
+	}
+}
+
+/// <summary>
+/// Compare les deux chanes spcifies, caractre par caractre, aprs conversion par la table spcifie (cf. ComparerChaine)
+/// </summary>
+/// <param name="chaine1">Chane "1"  comparer</param>
+/// <param name="chaine2">Chane "2"  comparer</param>
+/// <param name="tableConversion">Table de conversion des caractres (cf. ObtenirTableConversion)</param>
+/// <returns>-1 si la chane "1" est plus petite que la chane "2", 1 si la chane "1" est plus grande que la chane "2", sinon 0</returns>
+/*static*/ int CChaine::ComparerChaine(const char* chaine1, const char* chaine2, const unsigned char* tableConversion)
+{
+	// Une chane vide (ou non dfinie) est place aprs toute autre chane
+	if ((chaine1 == NULL) || (*chaine1 == 0))
+	{
+		return ((chaine2 == NULL) || (*chaine2 == 0)) ? 0 : 1;
+	}
+	else if ((chaine2 == NULL) || (*chaine2 == 0)) return -1;
+	// Seul le caractre nul tant converti en 0, une chane prfixe de l'autre est plus petite que celle-ci
+	while (true)
+	{
+		unsigned char caractere1 = tableConversion[(unsigned char)*chaine1];
+		unsigned char caractere2 = tableConversion[(unsigned char)*chaine2];
+		if (caractere1 != caractere2) return (caractere1 < caractere2) ? -1 : 1;
+		if (caractere1 == 0) return 0;
+		chaine1++;
+		chaine2++;
 	}
 }
 
+/// <summary>
+/// Fonction de comparaison directe de deux chanes de manire stricte (cf. ObtenirComparateur)
+/// </summary>
+/// <param name="entite">Chane  comparer</param>
+/// <param name="autreEntite">Autre chane  comparer</param>
+/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+/*static*/ int CChaine::ComparerEntites(const CEntite& entite, const CEntite& autreEntite)
+{
+	return ComparerChaine(((const CChaine&)entite).m_Adresse, ((const CChaine&)autreEntite).m_Adresse, TablesConversion[CChaine::ComparaisonStricte]);
+}
+
+/// <summary>
+/// Fonction de comparaison directe de deux chanes sans distinction de casse (cf. ObtenirComparateur)
+/// </summary>
+/// <param name="entite">Chane  comparer</param>
+/// <param name="autreEntite">Autre chane  comparer</param>
+/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+/*static*/ int CChaine::ComparerEntites_IC(const CEntite& entite, const CEntite& autreEntite)
+{
+	return ComparerChaine(((const CChaine&)entite).m_Adresse, ((const CChaine&)autreEntite).m_Adresse, TablesConversion[CChaine::ComparaisonIC]);
+}
+
+/// <summary>
+/// Fonction de comparaison directe de deux chanes sans distinction d'accentuation (cf. ObtenirComparateur)
+/// </summary>
+/// <param name="entite">Chane  comparer</param>
+/// <param name="autreEntite">Autre chane  comparer</param>
+/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+/*static*/ int CChaine::ComparerEntites_IA(const CEntite& entite, const CEntite& autreEntite)
+{
+	return ComparerChaine(((const CChaine&)entite).m_Adresse, ((const CChaine&)autreEntite).m_Adresse, TablesConversion[CChaine::ComparaisonIA]);
+}
+
+/// <summary>
+/// Fonction de comparaison directe de deux chanes sans distinction de casse et d'accentuation (cf. ObtenirComparateur)
+/// </summary>
+/// <param name="entite">Chane  comparer</param>
+/// <param name="autreEntite">Autre chane  comparer</param>
+/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+/*static*/ int CChaine::ComparerEntites_ICA(const CEntite& entite, const CEntite& autreEntite)
+{
+	return ComparerChaine(((const CChaine&)entite).m_Adresse, ((const CChaine&)autreEntite).m_Adresse, TablesConversion[CChaine::ComparaisonICA]);
+}
+
 /// <summary>
 /// Indique si la modalit de comparaison spcifie sert comme critre d'unicit de telles entits au sein d'un tableau
 /// </summary>
@@ -1026,6 +1260,39 @@ CEntite* CRegleSurChaine::Cloner() const
 	return new CRegleSurChaine(*this);
 }
 
+/// <summary>
+/// Permet de crer un duplicata de cette entit en lui transfrant ses ressources (dplacement), cette entit restant ensuite valide mais dans un tat indtermin
+/// <para>Une rgle tant rarement dplace, il s'agit d'un simple clonage (qui vite de la rduire  une CChaine)</para>
+/// </summary>
+/// <returns>Objet cr dynamiquement par dplacement</returns>
+CEntite* CRegleSurChaine::ClonerParDeplacement()
+{
+	return Cloner();
+}
+
+/// <summary>
+/// Retourne la taille en octets d'un objet de ce type d'entit (cf. ClonerDans)
+/// <para>Une classe drive qui ne rcrit pas cette mthode obtient la taille par dfaut de CEntite, la construction en place ne lui tant pas propose</para>
+/// </summary>
+/// <returns>Taille de l'objet</returns>
+long CRegleSurChaine::TailleObjet() const
+{
+	if (typeid(*this) != typeid(CRegleSurChaine)) return CEntite::TailleObjet();
+	return (long)sizeof(CRegleSurChaine);
+}
+
+/// <summary>
+/// Permet de crer un duplicata de cette entit  l'adresse spcifie, qui dispose d'au moins TailleObjet octets (construction "en place")
+/// <para>Une classe drive qui ne rcrit pas cette mthode ne la prend pas en charge, plutt que d'tre rduite  une CRegleSurChaine</para>
+/// </summary>
+/// <param name="adresse">Adresse de l'emplacement o construire le duplicata</param>
+/// <returns>Objet cr par clonage  cette adresse, sinon NULL (classe drive)</returns>
+CEntite* CRegleSurChaine::ClonerDans(void* adresse) const
+{
+	if (typeid(*this) != typeid(CRegleSurChaine)) return NULL;
+	return new (adresse) CRegleSurChaine(*this);
+}
+
 /// <summary>
 /// Indique si les donnes de cette entit sont valides
 /// </summary>
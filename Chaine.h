@@ -116,6 +116,28 @@ public:
 	/// <returns>Objet cr dynamiquement par clonage</returns>
 	CEntite* Cloner() const;
 
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit en lui transfrant ses ressources (dplacement), cette entit restant ensuite valide mais dans un tat indtermin
+	/// <para>Une classe drive qui ne rcrit pas cette mthode est simplement clone (cf. Cloner), plutt que rduite  une CChaine</para>
+	/// </summary>
+	/// <returns>Objet cr dynamiquement par dplacement</returns>
+	CEntite* ClonerParDeplacement();
+
+	/// <summary>
+	/// Retourne la taille en octets d'un objet de ce type d'entit (cf. ClonerDans)
+	/// <para>Une classe drive qui ne rcrit pas cette mthode obtient la taille par dfaut de CEntite, la construction en place ne lui tant pas propose</para>
+	/// </summary>
+	/// <returns>Taille de l'objet</returns>
+	long TailleObjet() const;
+
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit  l'adresse spcifie, qui dispose d'au moins TailleObjet octets (construction "en place")
+	/// <para>Une classe drive qui ne rcrit pas cette mthode ne la prend pas en charge, plutt que d'tre rduite  une CChaine</para>
+	/// </summary>
+	/// <param name="adresse">Adresse de l'emplacement o construire le duplicata</param>
+	/// <returns>Objet cr par clonage  cette adresse, sinon NULL (classe drive)</returns>
+	CEntite* ClonerDans(void* adresse) const;
+
 	/// <summary>
 	/// Indique si les donnes de cette entit sont valides
 	/// </summary>
@@ -131,6 +153,49 @@ public:
 	/// <returns>-1 si cette entit est "infrieure"  l'autre entit, 1 si cette entit est "suprieure"  l'autre entit, sinon 0 (en cas d'galit)</returns>
 	int Comparer(const CEntite& autreEntite, char modaliteComparaison) const;
 
+	/// <summary>
+	/// Calcule une valeur de hachage de cette entit, compatible avec la modalit de comparaison spcifie
+	/// <para>Deux entits gales selon cette modalit (Comparer retournant 0) doivent imprativement produire la mme valeur de hachage</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+	/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+	/// <returns>Vrai si ce type d'entit prend en charge le hachage selon cette modalit de comparaison, sinon faux</returns>
+	bool Hacher(char modaliteComparaison, unsigned long& valeurHachage) const;
+
+	/// <summary>
+	/// Retourne une fonction de comparaison directe de deux chanes, quivalente  Comparer pour la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <returns>Fonction de comparaison directe, sinon NULL (modalit inconnue)</returns>
+	ComparateurEntites ObtenirComparateur(char modaliteComparaison) const;
+
+	/// <summary>
+	/// Permet d'crire la cl de tri de cette chane selon la modalit de comparaison spcifie : ses caractres ramens  leur forme canonique (cf. ObtenirTableConversion), prcds d'un octet nul, une chane vide ayant pour cl un unique octet 1 afin d'tre place aprs toute autre
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  respecter</param>
+	/// <param name="tampon">Adresse du tampon recevant la cl</param>
+	/// <param name="taille">Taille du tampon en octets</param>
+	/// <returns>Longueur de la cl en octets (ventuellement suprieure  la taille du tampon, qui doit alors tre agrandi), sinon -1 (modalit inconnue)</returns>
+	long RepresentationOctets(char modaliteComparaison, unsigned char* tampon, long taille) const;
+
+	/// <summary>
+	/// Compare cette chane au contenu de chane spcifi, selon la modalit de comparaison spcifie, comme Comparer le ferait avec une chane de ce contenu
+	/// </summary>
+	/// <param name="cle">Contenu de chane auquel on compare cette chane, sinon NULL (quivalent  une chane vide)</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <param name="resultat">[RESULTAT] -1 si cette chane est "infrieure"  la cl, 1 si elle lui est "suprieure", sinon 0 (en cas d'galit)</param>
+	/// <returns>Vrai si la comparaison a pu se faire, sinon faux (modalit inconnue)</returns>
+	bool ComparerACle(const char* cle, char modaliteComparaison, int& resultat) const;
+
+	/// <summary>
+	/// Calcule une valeur de hachage du contenu de chane spcifi, identique  celle (cf. Hacher) de toute chane gale  ce contenu selon la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="cle">Contenu de chane  hacher, sinon NULL (quivalent  une chane vide)</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+	/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+	/// <returns>Vrai si le hachage a pu se faire, sinon faux (modalit inconnue)</returns>
+	bool HacherCle(const char* cle, char modaliteComparaison, unsigned long& valeurHachage) const;
+
 public:
 	/// <summary>
 	/// Constructeur par dfaut
@@ -143,6 +208,12 @@ public:
 	/// <param name="source">Chane source de cette copie</param>
 	CChaine(const CChaine& source);
 
+	/// <summary>
+	/// Constructeur par dplacement : le contenu de la source lui est retir, sans nouvelle allocation
+	/// </summary>
+	/// <param name="source">Chane source de ce dplacement, qui devient vide</param>
+	CChaine(CChaine&& source);
+
 	/// <summary>
 	/// Constructeur spcifique
 	/// </summary>
@@ -581,11 +652,6 @@ private:
 	/// </summary>
 	typedef bool(*TesteurEgaliteCaracteres)(char, char);
 
-	/// <summary>
-	/// Dfinit un type de donnes pour les fonctions capables de comparer deux caractres
-	/// </summary>
-	typedef int(*ComparateurCaracteres)(char, char);
-
 	/// <summary>
 	/// Retourne la fonction de test d'galit entre deux caractres en fonction des options spcifies
 	/// </summary>
@@ -595,12 +661,77 @@ private:
 	static TesteurEgaliteCaracteres ObtenirTesteurEgaliteCaracteres(bool ignorerCasse, bool ignorerAccentuation);
 
 	/// <summary>
-	/// Retourne la fonction de comparaison entre deux caractres en fonction des options spcifies
+	/// Retourne la table de conversion de chaque caractre vers sa forme canonique (celle que comparent les fonctions ComparerCaractere) en fonction des options spcifies
+	/// <para>Les tables sont construites lors de l'initialisation statique du programme (cf. CConstructionTablesConversion) : les comparaisons de chanes (y compris par les fonctions obtenues par ObtenirComparateur) ralises lors de l'initialisation statique d'autres units de compilation peuvent donc encore trouver des tables nulles</para>
 	/// </summary>
 	/// <param name="ignorerCasse">Indique si la comparaison doit ignorer les diffrences de casse</param>
 	/// <param name="ignorerAccentuation">Indique si la comparaison doit ignorer les diffrences d'accentuation</param>
-	/// <returns>Fonction de comparaison entre deux caractres en fonction des options spcifies</returns>
-	static ComparateurCaracteres ObtenirComparateurCaracteres(bool ignorerCasse, bool ignorerAccentuation);
+	/// <returns>Table de 256 caractres, indexe par le code (non sign) de chaque caractre</returns>
+	static const unsigned char* ObtenirTableConversion(bool ignorerCasse, bool ignorerAccentuation);
+
+	/// <summary>
+	/// Compare les deux chanes spcifies, caractre par caractre, aprs conversion par la table spcifie (cf. ComparerChaine)
+	/// </summary>
+	/// <param name="chaine1">Chane "1"  comparer</param>
+	/// <param name="chaine2">Chane "2"  comparer</param>
+	/// <param name="tableConversion">Table de conversion des caractres (cf. ObtenirTableConversion)</param>
+	/// <returns>-1 si la chane "1" est plus petite que la chane "2", 1 si la chane "1" est plus grande que la chane "2", sinon 0</returns>
+	static int ComparerChaine(const char* chaine1, const char* chaine2, const unsigned char* tableConversion);
+
+	/// <summary>
+	/// Fonction de comparaison directe de deux chanes de manire stricte (cf. ObtenirComparateur)
+	/// </summary>
+	/// <param name="entite">Chane  comparer</param>
+	/// <param name="autreEntite">Autre chane  comparer</param>
+	/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+	static int ComparerEntites(const CEntite& entite, const CEntite& autreEntite);
+
+	/// <summary>
+	/// Fonction de comparaison directe de deux chanes sans distinction de casse (cf. ObtenirComparateur)
+	/// </summary>
+	/// <param name="entite">Chane  comparer</param>
+	/// <param name="autreEntite">Autre chane  comparer</param>
+	/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+	static int ComparerEntites_IC(const CEntite& entite, const CEntite& autreEntite);
+
+	/// <summary>
+	/// Fonction de comparaison directe de deux chanes sans distinction d'accentuation (cf. ObtenirComparateur)
+	/// </summary>
+	/// <param name="entite">Chane  comparer</param>
+	/// <param name="autreEntite">Autre chane  comparer</param>
+	/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+	static int ComparerEntites_IA(const CEntite& entite, const CEntite& autreEntite);
+
+	/// <summary>
+	/// Fonction de comparaison directe de deux chanes sans distinction de casse et d'accentuation (cf. ObtenirComparateur)
+	/// </summary>
+	/// <param name="entite">Chane  comparer</param>
+	/// <param name="autreEntite">Autre chane  comparer</param>
+	/// <returns>-1 si la chane est plus petite que l'autre chane, 1 si la chane est plus grande que l'autre chane, sinon 0</returns>
+	static int ComparerEntites_ICA(const CEntite& entite, const CEntite& autreEntite);
+
+private:
+	/// <summary>
+	/// Tables de conversion des caractres, une par modalit de comparaison (cf. ObtenirTableConversion)
+	/// </summary>
+	static unsigned char TablesConversion[CChaine::ComparaisonICA + 1][256];
+
+	/// <summary>
+	/// Dfinit la construction des tables de conversion des caractres, ralise une fois pour toutes lors de l'initialisation statique du programme, avant qu'aucun fil d'excution ne puisse comparer des chanes
+	/// </summary>
+	class CConstructionTablesConversion
+	{
+	public:
+		/// <summary>
+		/// Constructeur par dfaut : construit les tables de conversion des caractres
+		/// </summary>
+		CConstructionTablesConversion();
+	};
+
+	/// <summary>
+	/// Instance dont la construction statique construit les tables de conversion des caractres
+	/// </summary>
+	static CConstructionTablesConversion ConstructionTablesConversion;
 };
 
 /// <summary>
@@ -622,6 +753,27 @@ public:
 	/// <returns>Objet cr dynamiquement par clonage</returns>
 	CEntite* Cloner() const;
 
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit en lui transfrant ses ressources (dplacement), cette entit restant ensuite valide mais dans un tat indtermin
+	/// </summary>
+	/// <returns>Objet cr dynamiquement par dplacement</returns>
+	CEntite* ClonerParDeplacement();
+
+	/// <summary>
+	/// Retourne la taille en octets d'un objet de ce type d'entit (cf. ClonerDans)
+	/// <para>Une classe drive qui ne rcrit pas cette mthode obtient la taille par dfaut de CEntite, la construction en place ne lui tant pas propose</para>
+	/// </summary>
+	/// <returns>Taille de l'objet</returns>
+	long TailleObjet() const;
+
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit  l'adresse spcifie, qui dispose d'au moins TailleObjet octets (construction "en place")
+	/// <para>Une classe drive qui ne rcrit pas cette mthode ne la prend pas en charge, plutt que d'tre rduite  une CRegleSurChaine</para>
+	/// </summary>
+	/// <param name="adresse">Adresse de l'emplacement o construire le duplicata</param>
+	/// <returns>Objet cr par clonage  cette adresse, sinon NULL (classe drive)</returns>
+	CEntite* ClonerDans(void* adresse) const;
+
 	/// <summary>
 	/// Indique si les donnes de cette entit sont valides
 	/// </summary>
@@ -130,17 +130,22 @@ bool CDocumentHtml::OuvrirBalise(const char* nomBalise, const char* attributs)
 {
 	if (!m_EcritureBalisePossible) return false;
 	if ((CChaine::LongueurChaine(nomBalise, true) < 1) || !CChaine::ChaineRespecte(nomBalise, CChaine::AccepterLettresNA | CChaine::AccepterChiffres)) return false;
-	CChaine balise;
-	if (balise.Modifier(nomBalise, (char)(CChaine::SuppressionEspacesSuperflus | CChaine::EnMinuscule)))
+	// La balise est directement confie au tableau des balises ouvertes, qui en devient propritaire (sans clonage)
+	CChaine* balise = new CChaine();
+	if (balise->Modifier(nomBalise, (char)(CChaine::SuppressionEspacesSuperflus | CChaine::EnMinuscule)))
 	{
-		if (m_BalisesOuvertes.Ajouter(balise))
+		if (m_BalisesOuvertes.Adopter(balise))
 		{
 			for (long i = 0, n = m_BalisesOuvertes.Nombre() - 1; i < n; i++) fprintf((FILE*)m_Fichier, "\t");
-			fprintf((FILE*)m_Fichier, "<%s", balise.Contenu());
+			fprintf((FILE*)m_Fichier, "<%s", balise->Contenu());
 			if (attributs != NULL) fprintf((FILE*)m_Fichier, " %s", attributs);
 			fprintf((FILE*)m_Fichier, ">\n");
 		}
 	}
+	else
+	{
+		delete balise;
+	}
 	return true;
 }
 
@@ -166,19 +171,26 @@ bool CDocumentHtml::FermerBalise(const char* nomBalise, bool toutFermerJusqueBal
 	else
 	{
 		bool reussi = false;
+		// Les balises ouvertes ne comportant que des lettres non accentues, en minuscules, et des chiffres (cf. OuvrirBalise), un nom de mme nature leur est directement compar sans distinction de casse, sans construire de chane ; seul un autre nom (entour d'espaces, par exemple) est d'abord normalis
+		const char* cle = nomBalise;
 		CChaine balise;
-		if (balise.Modifier(nomBalise, (char)(CChaine::SuppressionEspacesSuperflus | CChaine::EnMinuscule)))
+		if (!CChaine::ChaineRespecte(nomBalise, CChaine::AccepterLettresNA | CChaine::AccepterChiffres))
+		{
+			cle = balise.Modifier(nomBalise, (char)(CChaine::SuppressionEspacesSuperflus | CChaine::EnMinuscule)) ? balise.Contenu() : NULL;
+		}
+		if (cle != NULL)
 		{
 			if (toutFermerJusqueBaliseSpecifiee)
 			{
-				if (m_BalisesOuvertes.Rechercher(balise, CChaine::ComparaisonStricte) >= 0)
+				if (m_BalisesOuvertes.Rechercher(cle, CChaine::ComparaisonIC) >= 0)
 				{
 					reussi = true;
 					for (long iBO = m_BalisesOuvertes.Nombre() - 1; iBO >= 0; iBO--)
 					{
-						const CChaine& baliseOuverte = m_BalisesOuvertes.Element<const CChaine>(iBO);
+						// La comparaison prcde la fermeture, qui dtruit la balise ouverte
+						bool derniere = (m_BalisesOuvertes.Element<const CChaine>(iBO).Comparer(cle, CChaine::ComparaisonIC) == 0);
 						reussi = reussi && FermerBalise();
-						if (baliseOuverte.Comparer(balise, CChaine::ComparaisonStricte) == 0) break;
+						if (derniere) break;
 					}
 				}
 			}
@@ -186,7 +198,7 @@ bool CDocumentHtml::FermerBalise(const char* nomBalise, bool toutFermerJusqueBal
 			{
 				long iBO = m_BalisesOuvertes.Nombre() - 1;
 				const CChaine& baliseOuverte = m_BalisesOuvertes.Element<const CChaine>(iBO);
-				reussi = (baliseOuverte.Comparer(balise, CChaine::ComparaisonStricte) == 0) && FermerBalise();
+				reussi = (baliseOuverte.Comparer(cle, CChaine::ComparaisonIC) == 0) && FermerBalise();
 			}
 		}
 		return reussi;
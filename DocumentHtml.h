@@ -142,7 +142,7 @@ private:
 	bool m_CreationReussie;
 
 	/// <summary>
-	/// Pile des balises actuellement ouvertes
+	/// Pile des balises actuellement ouvertes, rarement plus profonde que le tableau des pointeurs interne d'un tableau (cf. CTableau::TailleInterne), si bien que l'empilement et le dpilement n'y sollicitent pas le tas
 	/// </summary>
 	CTableau m_BalisesOuvertes;
 };
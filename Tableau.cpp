@@ -1,23 +1,16 @@
 #include "BisConsole.h"
+#include <new>
+#include <malloc.h>
 #include "Tableau.h"
+#include "Tri.h"
 
 //---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-/// <summary>
-/// Recherche dichotomique
-/// </summary>
-const void* bsearch_c(const void* key, const void* base, size_t num, size_t width, int(*compare)(const void*, const void*, const void*), const void* context);
-
 /// <summary>
 /// Recherche squentielle
 /// </summary>
 const void* lfind_c(const void* key, const void* base, size_t num, size_t width, int(*compare)(const void*, const void*, const void*), const void* context);
 
-/// <summary>
-/// Tri "rapide"
-/// </summary>
-void qsort_c(void* base, size_t num, size_t width, int(*compare)(const void*, const void*, const void*), const void* context);
-
 //---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 /// <summary>
@@ -70,6 +63,36 @@ CEntite::CEntite(const CEntite& source)
 	return new CEntite(*this);
 }
 
+/// <summary>
+/// Permet de crer un duplicata de cette entit en lui transfrant ses ressources (dplacement), cette entit restant ensuite valide mais dans un tat indtermin
+/// <para>Par dfaut, il s'agit d'un simple clonage ; toute classe drive d'une classe qui rcrit cette mthode doit elle aussi la rcrire</para>
+/// </summary>
+/// <returns>Objet cr dynamiquement par dplacement</returns>
+/*virtual*/ CEntite* CEntite::ClonerParDeplacement()
+{
+	return Cloner();
+}
+
+/// <summary>
+/// Retourne la taille en octets d'un objet de ce type d'entit (cf. ClonerDans)
+/// </summary>
+/// <returns>Taille de l'objet</returns>
+/*virtual*/ long CEntite::TailleObjet() const
+{
+	return (long)sizeof(CEntite);
+}
+
+/// <summary>
+/// Permet de crer un duplicata de cette entit  l'adresse spcifie, qui dispose d'au moins TailleObjet octets (construction "en place")
+/// <para>Par dfaut, ce n'est pas pris en charge ; toute classe drive d'une classe qui rcrit cette mthode et TailleObjet doit elle aussi les rcrire</para>
+/// </summary>
+/// <param name="adresse">Adresse de l'emplacement o construire le duplicata</param>
+/// <returns>Objet cr par clonage  cette adresse, sinon NULL si ce type d'entit ne le prend pas en charge</returns>
+/*virtual*/ CEntite* CEntite::ClonerDans(void* adresse) const
+{
+	return NULL;
+}
+
 /// <summary>
 /// Indique si les donnes de cette entit sont valides
 /// </summary>
@@ -102,346 +125,3071 @@ CEntite::CEntite(const CEntite& source)
 	return 0;
 }
 
+/// <summary>
+/// Calcule une valeur de hachage de cette entit, compatible avec la modalit de comparaison spcifie
+/// <para>Deux entits gales selon cette modalit (Comparer retournant 0) doivent imprativement produire la mme valeur de hachage</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+/// <returns>Vrai si ce type d'entit prend en charge le hachage selon cette modalit de comparaison, sinon faux</returns>
+/*virtual*/ bool CEntite::Hacher(char modaliteComparaison, unsigned long& valeurHachage) const
+{
+	valeurHachage = 0;
+	return false;
+}
+
+/// <summary>
+/// Retourne une fonction de comparaison directe, quivalente  Comparer pour la modalit de comparaison spcifie, dont les tris peuvent tirer parti
+/// <para>Cette fonction doit convenir  toute entit que celle pour laquelle cette mthode est appele considre comme valide (cf. TesterValidite)</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <returns>Fonction de comparaison directe, sinon NULL (les comparaisons passent alors par Comparer)</returns>
+/*virtual*/ CEntite::ComparateurEntites CEntite::ObtenirComparateur(char modaliteComparaison) const
+{
+	return NULL;
+}
+
+/// <summary>
+/// Permet d'crire la cl de tri de cette entit selon la modalit de comparaison spcifie : une suite d'octets dont la comparaison lexicographique (octets non signs, une cl tant plus petite que celles qu'elle prfixe) ordonne les entits exactement comme Comparer
+/// <para>Un tri avec l'option CTableau::TriParCles calcule ainsi une fois pour toutes la cl de chaque entit, au lieu de renormaliser les deux entits  chaque comparaison</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  respecter</param>
+/// <param name="tampon">Adresse du tampon recevant la cl</param>
+/// <param name="taille">Taille du tampon en octets<para>Si elle est insuffisante, rien n'est garanti quant au contenu du tampon</para></param>
+/// <returns>Longueur de la cl en octets (ventuellement suprieure  la taille du tampon, qui doit alors tre agrandi), sinon -1 si ce type d'entit ne prend pas en charge de cl de tri selon cette modalit</returns>
+/*virtual*/ long CEntite::RepresentationOctets(char modaliteComparaison, unsigned char* tampon, long taille) const
+{
+	return -1;
+}
+
+/// <summary>
+/// Compare cette entit  la cl spcifie (cf. CTableau::Rechercher), selon la modalit de comparaison spcifie, sans avoir  construire d'entit modle
+/// </summary>
+/// <param name="cle">Cl  laquelle on compare cette entit, sous la forme propre  ce type d'entit (le contenu d'une chane, par exemple)</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <param name="resultat">[RESULTAT] -1 si cette entit est "infrieure"  la cl, 1 si elle lui est "suprieure", sinon 0 (en cas d'galit)</param>
+/// <returns>Vrai si ce type d'entit prend en charge la comparaison  une cl selon cette modalit, sinon faux</returns>
+/*virtual*/ bool CEntite::ComparerACle(const char* cle, char modaliteComparaison, int& resultat) const
+{
+	resultat = 0;
+	return false;
+}
+
+/// <summary>
+/// Calcule une valeur de hachage de la cl spcifie, identique  celle (cf. Hacher) de toute entit de ce type gale  cette cl selon la modalit de comparaison spcifie
+/// </summary>
+/// <param name="cle">Cl  hacher, sous la forme propre  ce type d'entit</param>
+/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+/// <returns>Vrai si ce type d'entit prend en charge le hachage d'une cl selon cette modalit, sinon faux</returns>
+/*virtual*/ bool CEntite::HacherCle(const char* cle, char modaliteComparaison, unsigned long& valeurHachage) const
+{
+	valeurHachage = 0;
+	return false;
+}
+
 //---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+/// <summary>
+/// Marqueur d'un emplacement libr par un retrait, et qui ne doit pas interrompre un sondage
+/// </summary>
+/*static*/ const CEntite* const CIndexHachage::EmplacementLibere = (const CEntite*)&CIndexHachage::EmplacementLibere;
+
 /// <summary>
 /// Constructeur spcifique
 /// </summary>
-/// <param name="entiteParDefaut">Modle d'entit par dfaut (c'est ce qui dtermine le "dnominateur commun"  tout lment que l'on veut placer dans ce tableau)</param>
-CTableau::CTableau(const CEntite& entiteParDefaut)
-	:m_Nombre(0), m_Taille(0), m_Tableau(NULL), m_TriActuel(CTableau::NonTrie), m_EntiteParDefaut(entiteParDefaut.Cloner())
+/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit sert de critre de recherche dans cet index</param>
+CIndexHachage::CIndexHachage(char modaliteComparaison)
+	:m_Nombre(0), m_NombreOccupes(0), m_Taille(0), m_Entites(NULL), m_Hachages(NULL), m_ModaliteComparaison(modaliteComparaison)
 {
 }
 
 /// <summary>
-/// Constructeur par copie
+/// Destructeur
 /// </summary>
-/// <param name="source">Entit source de cette copie</param>
-CTableau::CTableau(const CTableau& source)
-	:m_Nombre(0), m_Taille(0), m_Tableau(NULL), m_TriActuel(CTableau::NonTrie), m_EntiteParDefaut(source.m_EntiteParDefaut->Cloner())
+CIndexHachage::~CIndexHachage()
 {
-	for (long indice = 0; indice < source.m_Nombre; indice++)
-	{
-		Ajouter(*(source.m_Tableau[indice]));
-	}
-	m_TriActuel = source.m_TriActuel;
+	if (m_Entites != NULL) free(m_Entites);
+	if (m_Hachages != NULL) free(m_Hachages);
 }
 
 /// <summary>
-/// Destructeur
+/// Accesseur de la modalit de comparaison de cet index
 /// </summary>
-CTableau::~CTableau()
+/// <returns>Modalit de comparaison</returns>
+char CIndexHachage::ModaliteComparaison() const
 {
-	Vider();
-	delete m_EntiteParDefaut;
+	return m_ModaliteComparaison;
 }
 
 /// <summary>
-/// Permet de crer un duplicata de cette entit
+/// Accesseur du nombre d'entits rfrences par cet index
 /// </summary>
-/// <returns>Objet cr dynamiquement par clonage</returns>
-CEntite* CTableau::Cloner() const
+/// <returns>Nombre d'entits</returns>
+long CIndexHachage::Nombre() const
 {
-	return new CTableau(*this);
+	return m_Nombre;
 }
 
 /// <summary>
-/// Permet de supprimer toutes les entits du tableau
+/// Permet de retirer toutes les entits de cet index
 /// </summary>
-void CTableau::Vider()
+void CIndexHachage::Vider()
 {
-	if (m_Tableau != NULL)
-	{
-		for (long indice = 0; indice < m_Nombre; indice++) delete m_Tableau[indice];
-		free(m_Tableau);
-		m_Tableau = NULL;
-	}
+	if (m_Entites != NULL) memset(m_Entites, 0, m_Taille * sizeof(const CEntite*));
 	m_Nombre = 0;
-	m_Taille = 0;
-	m_TriActuel = CTableau::NonTrie;
+	m_NombreOccupes = 0;
 }
 
 /// <summary>
-/// Permet d'ajouter une nouvelle entit en fin de tableau,  partir du modle spcifi d'entit
+/// Retourne l'emplacement de dpart du sondage dans la table pour la valeur de hachage spcifie
 /// </summary>
-/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
-/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
-bool CTableau::Ajouter(const CEntite& entiteAAjouter)
+/// <param name="valeurHachage">Valeur de hachage</param>
+/// <returns>Indice de l'emplacement de dpart</returns>
+long CIndexHachage::EmplacementInitial(unsigned long valeurHachage) const
 {
-	return Inserer(m_Nombre, entiteAAjouter);
+	// Brassage des bits de poids fort vers les bits de poids faible, seuls retenus par le masque de la taille de la table
+	valeurHachage ^= valeurHachage >> 16;
+	valeurHachage *= 0x45D9F3BUL;
+	valeurHachage ^= valeurHachage >> 16;
+	return (long)(valeurHachage & (unsigned long)(m_Taille - 1));
 }
 
 /// <summary>
-/// Permet d'insrer une nouvelle entit  la position spcifie du tableau,  partir du modle spcifi d'entit
+/// Permet de redistribuer toutes les entits rfrences dans une table de la taille spcifie
 /// </summary>
-/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
-/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
-/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
-bool CTableau::Inserer(long indiceInsertion, const CEntite& entiteAAjouter)
+/// <param name="nouvelleTaille">Nouvelle taille de la table (puissance de 2)</param>
+/// <returns>Vrai si la redistribution a pu se faire, sinon faux</returns>
+bool CIndexHachage::Redimensionner(long nouvelleTaille)
 {
-	// Vrifier la validit des paramtres
-	if ((indiceInsertion < 0) || (indiceInsertion > m_Nombre)) return false;
-	if (!entiteAAjouter.EstValide(m_EntiteParDefaut)) return false;
-	// Vrifier la ou les unicits  tester
-	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	const CEntite** nouvellesEntites = (const CEntite**)calloc(nouvelleTaille, sizeof(const CEntite*));
+	if (nouvellesEntites == NULL) return false;
+	unsigned long* nouveauxHachages = (unsigned long*)malloc(nouvelleTaille * sizeof(unsigned long));
+	if (nouveauxHachages == NULL)
 	{
-		if (m_EntiteParDefaut->EstComparaisonPourUnicite(modaliteComparaison))
-		{
-			if (Rechercher(entiteAAjouter, modaliteComparaison) >= 0) return false;
-		}
-	}
-	// Cration d'un nouvel objet clone de celui  ajouter
-	CEntite* entiteClonee = entiteAAjouter.Cloner();
-	if (entiteClonee == NULL) return false;
-	if (!entiteClonee->EstValide(m_EntiteParDefaut))
-	{
-		delete entiteClonee;
+		free(nouvellesEntites);
 		return false;
 	}
-	// Ajustement si ncessaire de la taille du tableau des pointeurs
-	if (m_Nombre == m_Taille)
+	const CEntite** anciennesEntites = m_Entites;
+	unsigned long* anciensHachages = m_Hachages;
+	long ancienneTaille = m_Taille;
+	m_Entites = nouvellesEntites;
+	m_Hachages = nouveauxHachages;
+	m_Taille = nouvelleTaille;
+	m_NombreOccupes = m_Nombre;
+	// Redistribution des seules entits rfrences (les emplacements librs disparaissent)
+	for (long indice = 0; indice < ancienneTaille; indice++)
 	{
-		long nouvelleTaille = m_Taille + 10;
-		void* nouvelleAdresse = (m_Tableau == NULL) ? malloc(nouvelleTaille * sizeof(CEntite*)) : realloc(m_Tableau, nouvelleTaille * sizeof(CEntite*));
-		if (nouvelleAdresse == NULL)
-		{
-			delete entiteClonee;
-			return false;
-		}
-		m_Tableau = (CEntite**)nouvelleAdresse;
-		m_Taille = nouvelleTaille;
+		const CEntite* entite = anciennesEntites[indice];
+		if ((entite == NULL) || (entite == EmplacementLibere)) continue;
+		long emplacement = EmplacementInitial(anciensHachages[indice]);
+		while (m_Entites[emplacement] != NULL) emplacement = (emplacement + 1) & (m_Taille - 1);
+		m_Entites[emplacement] = entite;
+		m_Hachages[emplacement] = anciensHachages[indice];
 	}
-	// Dcalage des pointeurs vers les lments, d'une position vers la position suivante, et ce,  partir de la position d'insertion
-	if (indiceInsertion < m_Nombre)
+	if (anciennesEntites != NULL) free(anciennesEntites);
+	if (anciensHachages != NULL) free(anciensHachages);
+	return true;
+}
+
+/// <summary>
+/// Permet de rfrencer l'entit spcifie dans cet index
+/// </summary>
+/// <param name="entite">Adresse de l'entit  rfrencer</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CIndexHachage::Ajouter(const CEntite* entite)
+{
+	if (entite == NULL) return false;
+	unsigned long valeurHachage;
+	if (!entite->Hacher(m_ModaliteComparaison, valeurHachage)) return false;
+	// Maintien d'un taux d'occupation (emplacements librs compris) d'au plus 3/4
+	if (((m_NombreOccupes + 1) * 4) > (m_Taille * 3))
 	{
-		memmove(m_Tableau + (indiceInsertion + 1), m_Tableau + indiceInsertion, (m_Nombre - indiceInsertion) * sizeof(CEntite*));
+		long nouvelleTaille = (m_Taille == 0) ? 16 : m_Taille;
+		while (((m_Nombre + 1) * 2) > nouvelleTaille) nouvelleTaille *= 2;
+		if (!Redimensionner(nouvelleTaille)) return false;
 	}
-	// Copie de l'adresse du nouvel objet clone de celui  ajouter  la position spcifie
-	m_Tableau[indiceInsertion] = entiteClonee;
-	// Incrmentation du nombre d'lments
+	long emplacement = EmplacementInitial(valeurHachage);
+	while ((m_Entites[emplacement] != NULL) && (m_Entites[emplacement] != EmplacementLibere)) emplacement = (emplacement + 1) & (m_Taille - 1);
+	if (m_Entites[emplacement] == NULL) m_NombreOccupes++;
+	m_Entites[emplacement] = entite;
+	m_Hachages[emplacement] = valeurHachage;
 	m_Nombre++;
-	// Indication de perte possible de l'tat actuel de tri
-	m_TriActuel = CTableau::NonTrie;
-	// Indication de russite de l'insertion
 	return true;
 }
 
 /// <summary>
-/// Permet de supprimer l'entit spcifie du tableau
+/// Permet de retirer de cet index l'entit spcifie par son adresse
 /// </summary>
-/// <param name="indiceElement">Indice de l'lment  supprimer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
-/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
-bool CTableau::Supprimer(long indiceElement)
+/// <param name="entite">Adresse de l'entit  retirer</param>
+/// <returns>Vrai si l'entit tait rfrence et a t retire, sinon faux</returns>
+bool CIndexHachage::Retirer(const CEntite* entite)
 {
-	// Vrifier la validit des paramtres
-	if ((indiceElement < 0) || (indiceElement >= m_Nombre)) return false;
-	// Suppression de l'lment spcifi par son indice
-	delete m_Tableau[indiceElement];
-	// Dcalage des pointeurs vers les lments, d'une position vers la position prcdente, et ce,  partir de la position suivant celle de suppression
-	if (indiceElement < (m_Nombre - 1))
+	if ((entite == NULL) || (m_Nombre == 0)) return false;
+	unsigned long valeurHachage;
+	if (!entite->Hacher(m_ModaliteComparaison, valeurHachage)) return false;
+	for (long emplacement = EmplacementInitial(valeurHachage); m_Entites[emplacement] != NULL; emplacement = (emplacement + 1) & (m_Taille - 1))
 	{
-		memmove(m_Tableau + indiceElement, m_Tableau + (indiceElement + 1), ((m_Nombre - 1) - indiceElement) * sizeof(CEntite*));
+		if (m_Entites[emplacement] == entite)
+		{
+			m_Entites[emplacement] = EmplacementLibere;
+			m_Nombre--;
+			return true;
+		}
 	}
-	// Dcrmentation du nombre d'lments
-	m_Nombre--;
-	if (m_Nombre >= 1)
+	return false;
+}
+
+/// <summary>
+/// Permet de rechercher une entit gale (selon la modalit de comparaison de cet index)  celle spcifie
+/// </summary>
+/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+/// <param name="entiteTrouvee">[RESULTAT] Adresse d'une entit gale trouve, sinon NULL</param>
+/// <returns>Vrai si la recherche a pu tre mene (hachage possible de l'entit  rechercher), sinon faux</returns>
+bool CIndexHachage::Rechercher(const CEntite& entiteARechercher, const CEntite*& entiteTrouvee) const
+{
+	entiteTrouvee = NULL;
+	unsigned long valeurHachage;
+	if (!entiteARechercher.Hacher(m_ModaliteComparaison, valeurHachage)) return false;
+	if (m_Nombre == 0) return true;
+	for (long emplacement = EmplacementInitial(valeurHachage); m_Entites[emplacement] != NULL; emplacement = (emplacement + 1) & (m_Taille - 1))
 	{
-		// Remise  NULL du pointeur stock dans la case suivante du dernier lment
-		m_Tableau[m_Nombre] = NULL;
-		// Optionnellement, on rduit la taille effective du tableau de pointeurs quand on a "trop" de cases non utilises dans ce tableau
-		if (m_Nombre < (m_Taille / 2))
+		const CEntite* entite = m_Entites[emplacement];
+		if ((entite != EmplacementLibere) && (m_Hachages[emplacement] == valeurHachage) && (entiteARechercher.Comparer(*entite, m_ModaliteComparaison) == 0))
 		{
-			long nouvelleTaille = m_Nombre;
-			void* nouvelleAdresse = realloc(m_Tableau, nouvelleTaille * sizeof(CEntite*));
-			if (nouvelleAdresse != NULL)
-			{
-				m_Tableau = (CEntite**)nouvelleAdresse;
-				m_Taille = nouvelleTaille;
-			}
+			entiteTrouvee = entite;
+			return true;
 		}
 	}
-	else
+	return true;
+}
+
+/// <summary>
+/// Permet de rechercher une entit gale (selon la modalit de comparaison de cet index)  la cl spcifie, sans construire d'entit modle (cf. CEntite::ComparerACle)
+/// </summary>
+/// <param name="cle">Cl  rechercher</param>
+/// <param name="modele">Entit du type des entits indexes, servant  hacher la cl (cf. CEntite::HacherCle)</param>
+/// <param name="entiteTrouvee">[RESULTAT] Adresse d'une entit gale trouve, sinon NULL</param>
+/// <returns>Vrai si la recherche a pu tre mene (hachage possible de la cl), sinon faux</returns>
+bool CIndexHachage::RechercherCle(const char* cle, const CEntite& modele, const CEntite*& entiteTrouvee) const
+{
+	entiteTrouvee = NULL;
+	unsigned long valeurHachage;
+	if (!modele.HacherCle(cle, m_ModaliteComparaison, valeurHachage)) return false;
+	if (m_Nombre == 0) return true;
+	for (long emplacement = EmplacementInitial(valeurHachage); m_Entites[emplacement] != NULL; emplacement = (emplacement + 1) & (m_Taille - 1))
 	{
-		// Comme on vient de supprimer le tout dernier lment, on revient dans l'tat initial du tableau
-		free(m_Tableau);
-		m_Tableau = NULL;
-		m_Taille = 0;
-		m_TriActuel = CTableau::NonTrie;
+		const CEntite* entite = m_Entites[emplacement];
+		int resultat;
+		if ((entite != EmplacementLibere) && (m_Hachages[emplacement] == valeurHachage) && entite->ComparerACle(cle, m_ModaliteComparaison, resultat) && (resultat == 0))
+		{
+			entiteTrouvee = entite;
+			return true;
+		}
 	}
-	// Indication de russite de la suppression
 	return true;
 }
 
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 /// <summary>
-/// Fonction de comparaison compatible avec le callback des fonctions qsort_c, bsearch_c et lfind_c
+/// Constructeur spcifique
 /// </summary>
-/// <param name="adresseEntite">Adresse d'un emplacement contenant l'adresse d'une entit</param>
-/// <param name="adresseAutreEntite">Adresse d'un autre emplacement contenant l'adresse d'une autre entit</param>
-/// <param name="contexte">Adresse du contexte de callback</param>
-/// <returns>-1 si l'entit est "infrieure"  l'autre entit, 1 si l'entit est "suprieure"  l'autre entit, sinon 0 (en cas d'galit)</returns>
-/*static*/ int CTableau::Comparer(const void* adresseEntite, const void* adresseAutreEntite, const void* contexte)
+/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'ordre de cet index</param>
+/// <param name="adresseTableau">Adresse du membre contenant l'adresse du tableau des pointeurs vers les entits indexes</param>
+CIndexTri::CIndexTri(char modaliteComparaison, CEntite** const* adresseTableau)
+	:m_Nombre(0), m_Taille(0), m_Indices(NULL), m_AdresseTableau(adresseTableau), m_ModaliteComparaison(modaliteComparaison)
 {
-	const CEntite& entite = *(*((const CEntite**)adresseEntite));
-	const CEntite& autreEntite = *(*((const CEntite**)adresseAutreEntite));
-	char modaliteComparaison = *((const char*)contexte);
-	return entite.Comparer(autreEntite, modaliteComparaison);
 }
 
 /// <summary>
-/// Permet de trier les entits selon la modalit de comparaison spcifie
+/// Destructeur
 /// </summary>
-/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors du tri des entits</param>
-/// <returns>Vrai si le tri est ralis, sinon faux</returns>
-bool CTableau::Trier(char modaliteComparaison)
+CIndexTri::~CIndexTri()
 {
-	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
-	if (modaliteComparaison == m_TriActuel) return true;
-	if (m_Nombre >= 2)
-	{
-		qsort_c(m_Tableau, m_Nombre, sizeof(CEntite*), Comparer, &modaliteComparaison);
-	}
-	// Indication de russite du tri
-	m_TriActuel = modaliteComparaison;
-	return true;
+	Vider();
 }
 
 /// <summary>
-/// Permet de rechercher une entit dans le tableau en fonction de la modalit de comparaison spcifie
+/// Accesseur de la modalit de comparaison de cet index
 /// </summary>
-/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
-/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors de la recherche de l'entit</param>
-/// <param name="indiceDebut">Indice de dbut de la recherche<para>Compris entre 0 et le nombre d'entits - 1</para></param>
-/// <returns>Indice de la premire occurrence d'entit correspondant  la recherche entame, sinon -1</returns>
-long CTableau::Rechercher(const CEntite& entiteARechercher, char modaliteComparaison, long indiceDebut) const
+/// <returns>Modalit de comparaison</returns>
+char CIndexTri::ModaliteComparaison() const
 {
-	if (!entiteARechercher.EstValide(m_EntiteParDefaut)) return -1;
-	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return -1;
-	if ((indiceDebut < 0) || (indiceDebut >= m_Nombre)) return -1;
-	const CEntite* adresseEntiteARechercher = &entiteARechercher;
-	const void* resultat = ((modaliteComparaison == m_TriActuel) ? bsearch_c : lfind_c)(&adresseEntiteARechercher, m_Tableau, m_Nombre, sizeof(CEntite*), Comparer, &modaliteComparaison);
-	return (resultat != NULL) ? (long)((CEntite**)resultat - m_Tableau) : -1;
+	return m_ModaliteComparaison;
 }
 
 /// <summary>
-/// Accesseur du nombre d'entits de ce tableau
+/// Accesseur du nombre d'entits rfrences par cet index
 /// </summary>
 /// <returns>Nombre d'entits</returns>
-long CTableau::Nombre() const
+long CIndexTri::Nombre() const
 {
 	return m_Nombre;
 }
 
 /// <summary>
-/// Indexeur d'une entit en fonction de son indice dans ce tableau
+/// Retourne l'indice, dans le tableau des pointeurs, de l'entit de rang spcifi selon l'ordre de cet index
 /// </summary>
-/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
-/// <returns>Rfrence de l'lment du tableau  l'indice valide, sinon l'entit par dfaut</returns>
-const CEntite& CTableau::Element(long indiceElement) const
+/// <param name="rang">Rang de l'entit selon l'ordre de cet index<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Indice de l'entit, sinon -1</returns>
+long CIndexTri::Indice(long rang) const
 {
-	return *(((indiceElement >= 0) && (indiceElement < m_Nombre)) ? m_Tableau[indiceElement] : m_EntiteParDefaut);
+	if ((rang < 0) || (rang >= m_Nombre)) return -1;
+	return m_Indices[rang];
 }
 
 /// <summary>
-/// Accesseur indiquant comment le tableau est actuellement tri
+/// Permet de retirer toutes les entits de cet index
 /// </summary>
-/// <returns>Nombre d'entits</returns>
-char CTableau::TriActuel() const
+void CIndexTri::Vider()
 {
-	return m_TriActuel;
+	if (m_Indices != NULL) free(m_Indices);
+	m_Indices = NULL;
+	m_Nombre = 0;
+	m_Taille = 0;
 }
 
 /// <summary>
-/// Indique si le tableau est actuellement tri (selon la modalit spcifie)
+/// Permet de reconstruire entirement cet index  partir des entits du tableau des pointeurs
 /// </summary>
-/// <param name="modaliteComparaison">Modalit de comparaison  tester comme modalit de tri actuel</param>
-/// <returns>Vrai si le tableau est actuellement tri selon la modalit de comparaison spcifie, sinon faux</returns>
-bool CTableau::EstTrie(char modaliteComparaison) const
+/// <param name="nombre">Nombre d'entits du tableau des pointeurs</param>
+/// <returns>Vrai si la construction a pu se faire, sinon faux</returns>
+bool CIndexTri::Construire(long nombre)
 {
-	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
-	return (modaliteComparaison == m_TriActuel);
+	if (nombre < 0) return false;
+	if (nombre > m_Taille)
+	{
+		void* nouvelleAdresse = (m_Indices == NULL) ? malloc(nombre * sizeof(long)) : realloc(m_Indices, nombre * sizeof(long));
+		if (nouvelleAdresse == NULL) return false;
+		m_Indices = (long*)nouvelleAdresse;
+		m_Taille = nombre;
+	}
+	for (long indice = 0; indice < nombre; indice++) m_Indices[indice] = indice;
+	m_Nombre = nombre;
+	if (m_Nombre >= 2) TrierIntrospectif(m_Indices, m_Nombre, *this);
+	return true;
 }
 
-//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+/// <summary>
+/// Permet de rfrencer l'entit qui vient d'tre insre  l'indice spcifi du tableau des pointeurs
+/// <para>Les indices suprieurs ou gaux dj rfrencs sont dcals d'une position</para>
+/// </summary>
+/// <param name="indiceInsertion">Indice d'insertion de l'entit dans le tableau des pointeurs</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CIndexTri::Inserer(long indiceInsertion)
+{
+	if ((indiceInsertion < 0) || (indiceInsertion > m_Nombre)) return false;
+	if (m_Nombre == m_Taille)
+	{
+		long nouvelleTaille = (m_Taille < 10) ? 10 : (m_Taille * 2);
+		void* nouvelleAdresse = (m_Indices == NULL) ? malloc(nouvelleTaille * sizeof(long)) : realloc(m_Indices, nouvelleTaille * sizeof(long));
+		if (nouvelleAdresse == NULL) return false;
+		m_Indices = (long*)nouvelleAdresse;
+		m_Taille = nouvelleTaille;
+	}
+	// Dcalage des indices des entits qui suivent la position d'insertion (inutile lors d'un ajout en fin de tableau)
+	if (indiceInsertion < m_Nombre)
+	{
+		for (long rang = 0; rang < m_Nombre; rang++)
+		{
+			if (m_Indices[rang] >= indiceInsertion) m_Indices[rang]++;
+		}
+	}
+	long rangInsertion = ChercherRang(*((*m_AdresseTableau)[indiceInsertion]), indiceInsertion);
+	if (rangInsertion < m_Nombre)
+	{
+		memmove(m_Indices + (rangInsertion + 1), m_Indices + rangInsertion, (m_Nombre - rangInsertion) * sizeof(long));
+	}
+	m_Indices[rangInsertion] = indiceInsertion;
+	m_Nombre++;
+	return true;
+}
 
-/****************************************************************************
-*bsearch.c - do a binary search
-*lfind.c - do a linear search
-*qsort.c - quicksort algorithm; qsort() library function for sorting arrays
-*
-*       Copyright (c) 1985-1997, Microsoft Corporation. All rights reserved.
-*
-*Purpose:
-*       defines bsearch() - do a binary search an an array
-*       defines _lfind() - do a linear search of an array.
-*       To implement the qsort() routine for sorting arrays.
-*
-*******************************************************************************/
+/// <summary>
+/// Permet de retirer de cet index l'entit sur le point d'tre supprime  l'indice spcifi du tableau des pointeurs
+/// <para>Les indices suprieurs dj rfrencs sont dcals d'une position</para>
+/// </summary>
+/// <param name="indiceElement">Indice de l'entit (encore prsente) dans le tableau des pointeurs</param>
+void CIndexTri::Retirer(long indiceElement)
+{
+	if ((indiceElement < 0) || (indiceElement >= m_Nombre)) return;
+	// Le couple (entit, indice) tant unique, sa borne infrieure est exactement son rang
+	long rangElement = ChercherRang(*((*m_AdresseTableau)[indiceElement]), indiceElement);
+	m_Nombre--;
+	if (rangElement < m_Nombre)
+	{
+		memmove(m_Indices + rangElement, m_Indices + (rangElement + 1), (m_Nombre - rangElement) * sizeof(long));
+	}
+	// Dcalage des indices des entits qui suivent la position de suppression (inutile lors d'une suppression en fin de tableau)
+	if (indiceElement < m_Nombre)
+	{
+		for (long rang = 0; rang < m_Nombre; rang++)
+		{
+			if (m_Indices[rang] > indiceElement) m_Indices[rang]--;
+		}
+	}
+}
 
-/***
-*char *bsearch() - do a binary search on an array
-*
-*Purpose:
-*       Does a binary search of a sorted array for a key.
-*
-*Entry:
-*       const char *key    - key to search for
-*       const char *base   - base of sorted array to search
-*       size_t num   - number of elements in array
-*       size_t width - number of bytes per element
-*       int (*compare)()   - pointer to function that compares two array
-*               elements, returning neg when #1 < #2, pos when #1 > #2, and
-*               0 when they are equal. Function is passed pointers to two
-*               array elements.
-*
-*Exit:
-*       if key is found:
-*               returns pointer to occurrence of key in array
-*       if key is not found:
-*               returns NULL
-*
-*Exceptions:
-*
-*******************************************************************************/
+/// <summary>
+/// Permet de rechercher, par dichotomie, la premire entit gale (selon la modalit de comparaison de cet index)  celle spcifie
+/// </summary>
+/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+/// <param name="indiceDebut">Indice minimal de l'entit recherche</param>
+/// <returns>Plus petit indice, suprieur ou gal  l'indice de dbut, d'une entit gale, sinon -1</returns>
+long CIndexTri::Rechercher(const CEntite& entiteARechercher, long indiceDebut) const
+{
+	long rang = ChercherRang(entiteARechercher, indiceDebut);
+	if (rang >= m_Nombre) return -1;
+	long indice = m_Indices[rang];
+	return (entiteARechercher.Comparer(*((*m_AdresseTableau)[indice]), m_ModaliteComparaison) == 0) ? indice : -1;
+}
+
+/// <summary>
+/// Permet de rechercher, par dichotomie, la premire entit gale (selon la modalit de comparaison de cet index)  la cl spcifie, sans construire d'entit modle (cf. CEntite::ComparerACle)
+/// </summary>
+/// <param name="cle">Cl  rechercher</param>
+/// <param name="indiceDebut">Indice minimal de l'entit recherche</param>
+/// <returns>Plus petit indice, suprieur ou gal  l'indice de dbut, d'une entit gale, sinon -1</returns>
+long CIndexTri::RechercherCle(const char* cle, long indiceDebut) const
+{
+	// Mme dichotomie que ChercherRang, la comparaison tant faite du point de vue de l'entit
+	long rangDebut = 0;
+	long rangFin = m_Nombre;
+	while (rangDebut < rangFin)
+	{
+		long rangMilieu = rangDebut + (rangFin - rangDebut) / 2;
+		long indiceMilieu = m_Indices[rangMilieu];
+		int resultat;
+		(*m_AdresseTableau)[indiceMilieu]->ComparerACle(cle, m_ModaliteComparaison, resultat);
+		if ((resultat < 0) || ((resultat == 0) && (indiceDebut > indiceMilieu)))
+		{
+			rangDebut = rangMilieu + 1;
+		}
+		else
+		{
+			rangFin = rangMilieu;
+		}
+	}
+	if (rangDebut >= m_Nombre) return -1;
+	long indice = m_Indices[rangDebut];
+	int resultat;
+	(*m_AdresseTableau)[indice]->ComparerACle(cle, m_ModaliteComparaison, resultat);
+	return (resultat == 0) ? indice : -1;
+}
+
+/// <summary>
+/// Recherche dichotomique du premier rang dont le couple (entit, indice) n'est pas infrieur au couple spcifi
+/// </summary>
+/// <param name="entite">Entit du couple de rfrence</param>
+/// <param name="indice">Indice du couple de rfrence</param>
+/// <returns>Rang compris entre 0 et le nombre d'entits</returns>
+long CIndexTri::ChercherRang(const CEntite& entite, long indice) const
+{
+	long rangDebut = 0;
+	long rangFin = m_Nombre;
+	while (rangDebut < rangFin)
+	{
+		long rangMilieu = rangDebut + (rangFin - rangDebut) / 2;
+		long indiceMilieu = m_Indices[rangMilieu];
+		int resultat = entite.Comparer(*((*m_AdresseTableau)[indiceMilieu]), m_ModaliteComparaison);
+		if ((resultat > 0) || ((resultat == 0) && (indice > indiceMilieu)))
+		{
+			rangDebut = rangMilieu + 1;
+		}
+		else
+		{
+			rangFin = rangMilieu;
+		}
+	}
+	return rangDebut;
+}
+
+/// <summary>
+/// Compare deux indices selon l'ordre de cet index (ce qui fait de l'index son propre comparateur lors de sa construction par tri)
+/// </summary>
+/// <param name="indice">Indice d'une entit</param>
+/// <param name="autreIndice">Indice d'une autre entit</param>
+/// <returns>-1 si l'entit du premier indice est "infrieure"  l'autre (ou, en cas d'galit, si son indice est infrieur), 1 dans le cas contraire, sinon 0</returns>
+int CIndexTri::operator()(long indice, long autreIndice) const
+{
+	int resultat = (*m_AdresseTableau)[indice]->Comparer(*((*m_AdresseTableau)[autreIndice]), m_ModaliteComparaison);
+	if (resultat != 0) return resultat;
+	return (indice < autreIndice) ? -1 : ((indice > autreIndice) ? 1 : 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// Constructeur par dfaut
+/// </summary>
+CArene::CArene()
+	:m_NombreBlocs(0), m_Taille(0), m_Blocs(NULL), m_OctetsUtilises(0)
+{
+	for (long classe = 0; classe < (CArene::TailleMaximale / CArene::Granularite); classe++)
+	{
+		m_Libres[classe] = NULL;
+		m_Courants[classe] = NULL;
+		m_Restants[classe] = 0;
+	}
+}
+
+/// <summary>
+/// Destructeur
+/// </summary>
+CArene::~CArene()
+{
+	Vider();
+	if (m_Blocs != NULL) free(m_Blocs);
+}
+
+/// <summary>
+/// Permet d'allouer un emplacement de la taille spcifie
+/// </summary>
+/// <param name="taille">Taille en octets de l'emplacement<para>Comprise entre 1 et TailleMaximale</para></param>
+/// <returns>Adresse de l'emplacement, sinon NULL</returns>
+void* CArene::Allouer(long taille)
+{
+	if ((taille < 1) || (taille > CArene::TailleMaximale)) return NULL;
+	long classe = (taille - 1) / CArene::Granularite;
+	long tailleEmplacement = (classe + 1) * CArene::Granularite;
+	void* adresse = m_Libres[classe];
+	if (adresse != NULL)
+	{
+		// Rutilisation du dernier emplacement libr de cette classe
+		m_Libres[classe] = *((void**)adresse);
+	}
+	else
+	{
+		// Dcoupage d'un nouvel emplacement dans le bloc en cours de cette classe
+		if ((m_Restants[classe] < tailleEmplacement) && !AjouterBloc(classe)) return NULL;
+		adresse = m_Courants[classe];
+		m_Courants[classe] += tailleEmplacement;
+		m_Restants[classe] -= tailleEmplacement;
+	}
+	m_OctetsUtilises += taille;
+	return adresse;
+}
+
+/// <summary>
+/// Permet de librer l'emplacement spcifi, qui devient rutilisable pour sa classe de tailles
+/// </summary>
+/// <param name="adresse">Adresse de l'emplacement, obtenue par Allouer</param>
+/// <param name="taille">Taille en octets demande lors de l'allocation de cet emplacement</param>
+void CArene::Liberer(void* adresse, long taille)
+{
+	if ((adresse == NULL) || (taille < 1) || (taille > CArene::TailleMaximale)) return;
+	long classe = (taille - 1) / CArene::Granularite;
+	*((void**)adresse) = m_Libres[classe];
+	m_Libres[classe] = adresse;
+	m_OctetsUtilises -= taille;
+}
+
+/// <summary>
+/// Indique si l'adresse spcifie se trouve dans l'un des blocs de cette arne
+/// </summary>
+/// <param name="adresse">Adresse  tester</param>
+/// <returns>Vrai si l'adresse appartient  cette arne, sinon faux</returns>
+bool CArene::Contient(const void* adresse) const
+{
+	// Recherche dichotomique du dernier bloc dbutant au plus  cette adresse
+	long indiceDebut = 0;
+	long indiceFin = m_NombreBlocs;
+	while (indiceDebut < indiceFin)
+	{
+		long indiceMilieu = indiceDebut + (indiceFin - indiceDebut) / 2;
+		if (m_Blocs[indiceMilieu] <= (const char*)adresse)
+		{
+			indiceDebut = indiceMilieu + 1;
+		}
+		else
+		{
+			indiceFin = indiceMilieu;
+		}
+	}
+	return (indiceDebut > 0) && ((const char*)adresse < (m_Blocs[indiceDebut - 1] + CArene::TailleBloc));
+}
+
+/// <summary>
+/// Permet de rendre en une seule fois tous les blocs de cette arne, ce qui invalide tous les emplacements allous
+/// </summary>
+void CArene::Vider()
+{
+	for (long indice = 0; indice < m_NombreBlocs; indice++) free(m_Blocs[indice]);
+	m_NombreBlocs = 0;
+	for (long classe = 0; classe < (CArene::TailleMaximale / CArene::Granularite); classe++)
+	{
+		m_Libres[classe] = NULL;
+		m_Courants[classe] = NULL;
+		m_Restants[classe] = 0;
+	}
+	m_OctetsUtilises = 0;
+}
+
+/// <summary>
+/// Accesseur du nombre de blocs allous
+/// </summary>
+/// <returns>Nombre de blocs</returns>
+long CArene::NombreBlocs() const
+{
+	return m_NombreBlocs;
+}
+
+/// <summary>
+/// Accesseur du nombre d'octets rservs par les blocs allous
+/// </summary>
+/// <returns>Nombre d'octets rservs</returns>
+__int64 CArene::OctetsReserves() const
+{
+	return (__int64)m_NombreBlocs * CArene::TailleBloc;
+}
+
+/// <summary>
+/// Accesseur du nombre d'octets demands par les emplacements actuellement allous
+/// </summary>
+/// <returns>Nombre d'octets utiliss</returns>
+__int64 CArene::OctetsUtilises() const
+{
+	return m_OctetsUtilises;
+}
+
+/// <summary>
+/// Accesseur du nombre d'octets rservs mais inutiliss (arrondis aux classes de tailles, emplacements librs et fins de blocs non encore dcoupes)
+/// </summary>
+/// <returns>Nombre d'octets perdus</returns>
+__int64 CArene::OctetsPerdus() const
+{
+	return OctetsReserves() - m_OctetsUtilises;
+}
+
+/// <summary>
+/// Permet d'allouer un nouveau bloc, qui devient le bloc en cours de dcoupage de la classe de tailles spcifie
+/// </summary>
+/// <param name="classe">Classe de tailles</param>
+/// <returns>Vrai si l'allocation a pu se faire, sinon faux</returns>
+bool CArene::AjouterBloc(long classe)
+{
+	// Ajustement si ncessaire de la taille du tableau des adresses de blocs (croissance gomtrique)
+	if (m_NombreBlocs == m_Taille)
+	{
+		long nouvelleTaille = (m_Taille < 16) ? 16 : (m_Taille * 2);
+		void* nouvelleAdresse = (m_Blocs == NULL) ? malloc(nouvelleTaille * sizeof(char*)) : realloc(m_Blocs, nouvelleTaille * sizeof(char*));
+		if (nouvelleAdresse == NULL) return false;
+		m_Blocs = (char**)nouvelleAdresse;
+		m_Taille = nouvelleTaille;
+	}
+	char* bloc = (char*)malloc(CArene::TailleBloc);
+	if (bloc == NULL) return false;
+	// Insertion du bloc  sa place dans le tableau des adresses de blocs, afin qu'il reste tri
+	long indice = m_NombreBlocs;
+	while ((indice > 0) && (m_Blocs[indice - 1] > bloc))
+	{
+		m_Blocs[indice] = m_Blocs[indice - 1];
+		indice--;
+	}
+	m_Blocs[indice] = bloc;
+	m_NombreBlocs++;
+	// Le reste ventuel du bloc prcdent de cette classe est abandonn
+	m_Courants[classe] = bloc;
+	m_Restants[classe] = CArene::TailleBloc;
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// Nature d'un lment retir : tat publi, rutilisable une fois rcupr
+/// </summary>
+static const char RetraitInstantane = 0;
+
+/// <summary>
+/// Nature d'un lment retir : tableau des pointeurs, libr une fois rcupr
+/// </summary>
+static const char RetraitTableau = 1;
+
+/// <summary>
+/// Nature d'un lment retir : entit, rendue au rdacteur une fois rcupre
+/// </summary>
+static const char RetraitEntite = 2;
+
+/// <summary>
+/// Permet de lire une poque modifie par un autre fil d'excution, d'un seul tenant mme l o une lecture de 64 bits n'est pas atomique
+/// </summary>
+/// <param name="epoque">Adresse de l'poque  lire</param>
+/// <returns>Valeur de l'poque</returns>
+static __int64 LireEpoque(const volatile __int64* epoque)
+{
+	// L'change n'a lieu que si l'poque vaut dj 0 : il ne modifie donc jamais sa valeur
+	return InterlockedCompareExchange64(const_cast<volatile __int64*>(epoque), 0, 0);
+}
+
+/// <summary>
+/// Constructeur par dfaut
+/// </summary>
+CPublicationTableau::CPublicationTableau()
+	:m_Epoque(1), m_Instantane(NULL), m_Retires(NULL), m_PremierRetire(0), m_NombreRetires(0), m_TailleRetires(0), m_EpoqueLimite(0), m_InstantanesLibres(NULL)
+{
+	for (long emplacement = 0; emplacement < CPublicationTableau::NombreMaximalLecteurs; emplacement++)
+	{
+		m_Reserves[emplacement] = 0;
+		m_Epoques[emplacement] = 0;
+	}
+}
+
+/// <summary>
+/// Destructeur : rend les tats et blocs retirs, ainsi que l'tat publi (mais pas le tableau des pointeurs qu'il dsigne), sans attendre les lecteurs
+/// </summary>
+CPublicationTableau::~CPublicationTableau()
+{
+	while (ExtraireRecuperable(true) != NULL) {}
+	if (m_Retires != NULL) free(m_Retires);
+	if (m_Instantane != NULL) free(m_Instantane);
+	while (m_InstantanesLibres != NULL)
+	{
+		CInstantaneTableau* instantane = m_InstantanesLibres;
+		m_InstantanesLibres = (CInstantaneTableau*)instantane->m_Tableau;
+		free(instantane);
+	}
+}
+
+/// <summary>
+/// Permet  un lecteur de rserver l'un des emplacements de lecteur
+/// </summary>
+/// <returns>Numro de l'emplacement rserv, sinon -1 (tous les emplacements sont rservs)</returns>
+long CPublicationTableau::ReserverEmplacement()
+{
+	for (long emplacement = 0; emplacement < CPublicationTableau::NombreMaximalLecteurs; emplacement++)
+	{
+		if (InterlockedCompareExchange(&m_Reserves[emplacement], 1, 0) == 0) return emplacement;
+	}
+	return -1;
+}
+
+/// <summary>
+/// Permet  un lecteur de rendre l'emplacement de lecteur qu'il avait rserv
+/// </summary>
+/// <param name="emplacement">Numro de l'emplacement rserv</param>
+void CPublicationTableau::RendreEmplacement(long emplacement)
+{
+	InterlockedExchange64(&m_Epoques[emplacement], 0);
+	InterlockedExchange(&m_Reserves[emplacement], 0);
+}
+
+/// <summary>
+/// Permet  un lecteur de commencer une lecture : il annonce l'poque actuelle, puis obtient l'tat publi, qui reste valide jusqu' TerminerLecture
+/// </summary>
+/// <param name="emplacement">Numro de l'emplacement rserv par ce lecteur</param>
+/// <returns>Adresse de l'tat publi</returns>
+const CInstantaneTableau* CPublicationTableau::CommencerLecture(long emplacement)
+{
+	// L'change fait office de barrire : soit le rdacteur voit cette annonce avant de rcuprer ce qu'il a retir, soit ce lecteur obtient un tat publi aprs ce retrait
+	InterlockedExchange64(&m_Epoques[emplacement], LireEpoque(&m_Epoque));
+	return m_Instantane;
+}
+
+/// <summary>
+/// Permet  un lecteur de terminer sa lecture, l'tat obtenu devenant rcuprable
+/// </summary>
+/// <param name="emplacement">Numro de l'emplacement rserv par ce lecteur</param>
+void CPublicationTableau::TerminerLecture(long emplacement)
+{
+	InterlockedExchange64(&m_Epoques[emplacement], 0);
+}
+
+/// <summary>
+/// Permet au rdacteur de publier un nouvel tat, l'tat prcdent tant retir (ainsi que son tableau des pointeurs, s'il en change)
+/// </summary>
+/// <param name="tableau">Adresse de dbut du tableau des pointeurs, qui ne doit plus tre ni modifi en de du nombre d'entits, ni rallou, ni libr</param>
+/// <param name="nombre">Nombre d'entits</param>
+/// <param name="triActuel">Modalit de comparaison du prfixe tri, sinon CTableau::NonTrie</param>
+/// <param name="nombreTries">Nombre d'entits du prfixe tri</param>
+/// <returns>Vrai si la publication a pu se faire, sinon faux (faute de mmoire, l'tat prcdent restant publi)</returns>
+bool CPublicationTableau::Publier(CEntite** tableau, long nombre, char triActuel, long nombreTries)
+{
+	CInstantaneTableau* instantane = m_InstantanesLibres;
+	if (instantane != NULL)
+	{
+		m_InstantanesLibres = (CInstantaneTableau*)instantane->m_Tableau;
+	}
+	else
+	{
+		instantane = (CInstantaneTableau*)malloc(sizeof(CInstantaneTableau));
+		if (instantane == NULL) return false;
+	}
+	instantane->m_Tableau = tableau;
+	instantane->m_Nombre = nombre;
+	instantane->m_TriActuel = triActuel;
+	instantane->m_NombreTries = nombreTries;
+	CInstantaneTableau* ancien = m_Instantane;
+	// La place des retraits est rserve avant la publication, qui ne peut plus tre annule ensuite
+	if (!ReserverRetires(2))
+	{
+		instantane->m_Tableau = (CEntite**)m_InstantanesLibres;
+		m_InstantanesLibres = instantane;
+		return false;
+	}
+	InterlockedExchangePointer((void* volatile*)&m_Instantane, instantane);
+	if (ancien != NULL)
+	{
+		if ((ancien->m_Tableau != NULL) && (ancien->m_Tableau != tableau)) AjouterRetire((void*)ancien->m_Tableau, RetraitTableau);
+		AjouterRetire(ancien, RetraitInstantane);
+	}
+	// Tout lecteur qui annonce la nouvelle poque obtiendra le nouvel tat
+	InterlockedIncrement64(&m_Epoque);
+	return true;
+}
+
+/// <summary>
+/// Accesseur de l'tat publi, pour le rdacteur
+/// </summary>
+/// <returns>Adresse de l'tat publi</returns>
+const CInstantaneTableau* CPublicationTableau::Instantane() const
+{
+	return m_Instantane;
+}
+
+/// <summary>
+/// Permet au rdacteur de retirer une entit que des lecteurs peuvent encore consulter, afin qu'elle ne soit dtruite qu'une fois rcuprable (cf. ExtraireRecuperable)
+/// </summary>
+/// <param name="entite">Adresse de l'entit retire</param>
+/// <returns>Vrai si le retrait a pu se faire, sinon faux (faute de mmoire, l'entit ne pouvant alors jamais tre dtruite sans risque)</returns>
+bool CPublicationTableau::Retirer(CEntite* entite)
+{
+	return AjouterRetire(entite, RetraitEntite);
+}
+
+/// <summary>
+/// Permet au rdacteur d'obtenir la plus ancienne entit retire qu'aucun lecteur ne peut plus consulter, les tats et tableaux de pointeurs retirs avant elle tant rendus au passage
+/// </summary>
+/// <param name="forcer">Indique si tout ce qui a t retir est rcuprable, ce qui suppose qu'il n'y a plus aucun lecteur</param>
+/// <returns>Adresse de l'entit  dtruire, sinon NULL (plus rien de rcuprable)</returns>
+CEntite* CPublicationTableau::ExtraireRecuperable(bool forcer)
+{
+	while (m_NombreRetires > 0)
+	{
+		CElementRetire& element = m_Retires[m_PremierRetire];
+		// La file tant ordonne par poques, elle n'est rcuprable que jusqu'au premier lment retir  une poque qu'un lecteur a pu annoncer
+		if (!forcer && (element.m_Epoque >= m_EpoqueLimite))
+		{
+			m_EpoqueLimite = EpoqueMinimale();
+			if (element.m_Epoque >= m_EpoqueLimite) return NULL;
+		}
+		void* adresse = element.m_Adresse;
+		char nature = element.m_Nature;
+		m_PremierRetire++;
+		m_NombreRetires--;
+		if (m_NombreRetires == 0) m_PremierRetire = 0;
+		if (nature == RetraitEntite) return (CEntite*)adresse;
+		if (nature == RetraitTableau)
+		{
+			free(adresse);
+		}
+		else
+		{
+			CInstantaneTableau* instantane = (CInstantaneTableau*)adresse;
+			instantane->m_Tableau = (CEntite**)m_InstantanesLibres;
+			m_InstantanesLibres = instantane;
+		}
+	}
+	return NULL;
+}
+
+/// <summary>
+/// Permet de s'assurer que la file des lments retirs peut recevoir le nombre spcifi d'lments supplmentaires
+/// </summary>
+/// <param name="nombre">Nombre d'lments supplmentaires</param>
+/// <returns>Vrai si la place est disponible, sinon faux</returns>
+bool CPublicationTableau::ReserverRetires(long nombre)
+{
+	if ((m_PremierRetire + m_NombreRetires + nombre) <= m_TailleRetires) return true;
+	if ((m_NombreRetires + nombre) <= (m_TailleRetires / 2))
+	{
+		// Les lments dj rcuprs en tte de file librent assez de place
+		memmove(m_Retires, m_Retires + m_PremierRetire, m_NombreRetires * sizeof(CElementRetire));
+		m_PremierRetire = 0;
+		return true;
+	}
+	long nouvelleTaille = (m_TailleRetires < 16) ? 16 : (m_TailleRetires * 2);
+	if (nouvelleTaille < (m_PremierRetire + m_NombreRetires + nombre)) nouvelleTaille = m_PremierRetire + m_NombreRetires + nombre;
+	void* nouvelleAdresse = realloc(m_Retires, nouvelleTaille * sizeof(CElementRetire));
+	if (nouvelleAdresse == NULL) return false;
+	m_Retires = (CElementRetire*)nouvelleAdresse;
+	m_TailleRetires = nouvelleTaille;
+	return true;
+}
+
+/// <summary>
+/// Permet d'ajouter un lment  la file des lments retirs, avec l'poque actuelle
+/// </summary>
+/// <param name="adresse">Adresse de l'lment retir</param>
+/// <param name="nature">Nature de l'lment (tat, tableau des pointeurs ou entit)</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CPublicationTableau::AjouterRetire(void* adresse, char nature)
+{
+	if (!ReserverRetires(1)) return false;
+	CElementRetire& element = m_Retires[m_PremierRetire + m_NombreRetires];
+	element.m_Adresse = adresse;
+	element.m_Epoque = m_Epoque;
+	element.m_Nature = nature;
+	m_NombreRetires++;
+	return true;
+}
+
+/// <summary>
+/// Retourne la plus petite poque annonce par un lecteur en cours de lecture, sinon l'poque actuelle
+/// </summary>
+/// <returns>poque en de de laquelle tout lment retir est rcuprable</returns>
+__int64 CPublicationTableau::EpoqueMinimale() const
+{
+	__int64 epoqueMinimale = m_Epoque;
+	MemoryBarrier();
+	for (long emplacement = 0; emplacement < CPublicationTableau::NombreMaximalLecteurs; emplacement++)
+	{
+		__int64 epoque = LireEpoque(&m_Epoques[emplacement]);
+		if ((epoque != 0) && (epoque < epoqueMinimale)) epoqueMinimale = epoque;
+	}
+	return epoqueMinimale;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// Dfinit un comparateur d'adresses d'entits passant par la mthode virtuelle Comparer, selon une modalit de comparaison fixe
+/// </summary>
+class CComparateurVirtuel
+{
+public:
+	CComparateurVirtuel(char modaliteComparaison) : m_ModaliteComparaison(modaliteComparaison) {}
+	int operator()(const CEntite* entite, const CEntite* autreEntite) const { return entite->Comparer(*autreEntite, m_ModaliteComparaison); }
+
+private:
+	char m_ModaliteComparaison;
+};
+
+/// <summary>
+/// Dfinit un comparateur d'adresses d'entits passant par une fonction de comparaison directe (cf. CEntite::ObtenirComparateur)
+/// </summary>
+class CComparateurDirect
+{
+public:
+	CComparateurDirect(CEntite::ComparateurEntites comparateur) : m_Comparateur(comparateur) {}
+	int operator()(const CEntite* entite, const CEntite* autreEntite) const { return m_Comparateur(*entite, *autreEntite); }
+
+private:
+	CEntite::ComparateurEntites m_Comparateur;
+};
+
+/// <summary>
+/// Dfinit un comparateur d'adresses d'entits selon une cl composite : chaque modalit de comparaison dpartage les entits gales selon les prcdentes
+/// </summary>
+class CComparateurMultiple
+{
+public:
+	CComparateurMultiple(const char* modalites, const CEntite::ComparateurEntites* comparateurs, int nombre) : m_Modalites(modalites), m_Comparateurs(comparateurs), m_Nombre(nombre) {}
+	int operator()(const CEntite* entite, const CEntite* autreEntite) const
+	{
+		for (int indice = 0; indice < m_Nombre; indice++)
+		{
+			// Fonction de comparaison directe de la modalit si le type d'entit en propose une, sinon appel virtuel
+			int resultat = (m_Comparateurs[indice] != NULL) ? m_Comparateurs[indice](*entite, *autreEntite) : entite->Comparer(*autreEntite, m_Modalites[indice]);
+			if (resultat != 0) return resultat;
+		}
+		return 0;
+	}
+
+private:
+	const char* m_Modalites;
+	const CEntite::ComparateurEntites* m_Comparateurs;
+	int m_Nombre;
+};
+
+/// <summary>
+/// Dfinit l'lment tri par un tri sur cls (cf. CTableau::TriParCles) : l'adresse d'une entit accompagne de sa cl de tri, dont les premiers octets sont recopis en un entier afin de dpartager la plupart des comparaisons sans accder  la cl
+/// </summary>
+class CEntiteCle
+{
+public:
+	unsigned __int64 m_Prefixe;
+	const unsigned char* m_Cle;
+	long m_Longueur;
+	CEntite* m_Entite;
+	int Paquet(long rang) const
+	{
+		// Paquet 0 pour une cl acheve avant ce rang, sinon 1 + l'octet de ce rang (lu dans le prfixe tant que possible)
+		if (rang >= m_Longueur) return 0;
+		return 1 + ((rang < 8) ? (int)((m_Prefixe >> (56 - 8 * rang)) & 0xFF) : (int)m_Cle[rang]);
+	}
+};
+
+/// <summary>
+/// Dfinit un paquet d'entits accompagnes de leurs cls de tri, restant  distribuer selon l'octet de rang spcifi de leurs cls (cf. CTableau::TriParDistribution)
+/// </summary>
+class CPlageCles
+{
+public:
+	long m_Debut;
+	long m_Nombre;
+	long m_Rang;
+};
+
+/// <summary>
+/// Dfinit un comparateur d'entits accompagnes de leurs cls de tri, par comparaison lexicographique des octets de celles-ci
+/// </summary>
+class CComparateurCles
+{
+public:
+	int operator()(const CEntiteCle& element, const CEntiteCle& autreElement) const
+	{
+		// Les prfixes complts par des octets nuls respectent l'ordre des cls, mais leur galit n'implique pas celle des cls
+		if (element.m_Prefixe != autreElement.m_Prefixe) return (element.m_Prefixe < autreElement.m_Prefixe) ? -1 : 1;
+		long longueur = (element.m_Longueur < autreElement.m_Longueur) ? element.m_Longueur : autreElement.m_Longueur;
+		if (longueur > 8)
+		{
+			int resultat = memcmp(element.m_Cle + 8, autreElement.m_Cle + 8, longueur - 8);
+			if (resultat != 0) return (resultat < 0) ? -1 : 1;
+		}
+		return (element.m_Longueur < autreElement.m_Longueur) ? -1 : ((element.m_Longueur > autreElement.m_Longueur) ? 1 : 0);
+	}
+};
+
+/// <summary>
+/// Dfinit le comparateur des modles d'un lot d'entits  ajouter (cf. CTableau::AjouterLot), selon une modalit de comparaison fixe : par leurs indices dans le lot (les modles gaux tant ordonns par indice), ou par leurs adresses
+/// </summary>
+class CComparateurLot
+{
+public:
+	CComparateurLot(const CEntite* const* entites, CEntite::ComparateurEntites comparateur, char modaliteComparaison) : m_Entites(entites), m_Comparateur(comparateur), m_ModaliteComparaison(modaliteComparaison) {}
+	int Comparer(const CEntite* entite, const CEntite* autreEntite) const
+	{
+		return (m_Comparateur != NULL) ? m_Comparateur(*entite, *autreEntite) : entite->Comparer(*autreEntite, m_ModaliteComparaison);
+	}
+	int operator()(const CEntite* entite, const CEntite* autreEntite) const
+	{
+		return Comparer(entite, autreEntite);
+	}
+	int operator()(long indice, long autreIndice) const
+	{
+		int resultat = Comparer(m_Entites[indice], m_Entites[autreIndice]);
+		if (resultat != 0) return resultat;
+		return (indice < autreIndice) ? -1 : ((indice > autreIndice) ? 1 : 0);
+	}
+
+private:
+	const CEntite* const* m_Entites;
+	CEntite::ComparateurEntites m_Comparateur;
+	char m_ModaliteComparaison;
+};
+
+/// <summary>
+/// Permet de trier les adresses d'entits (ou les lments qui les accompagnent de leurs cls de tri) spcifies, selon les options de tri et au moyen du comparateur spcifis
+/// </summary>
+/// <param name="entites">Adresse du premier lment  trier</param>
+/// <param name="nombre">Nombre d'entits  trier</param>
+/// <param name="comparateur">Objet comparateur d'adresses d'entits</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::TriStable et CTableau::TriParallele)</param>
+/// <param name="nombreFils">Nombre de fils d'excution d'un tri parallle (1 pour un tri en srie)</param>
+/// <returns>Vrai si le tri est ralis, sinon faux (faute de mmoire pour un tri stable)</returns>
+template <class T, class C> bool TrierPlageEntites(T* entites, long nombre, const C& comparateur, char optionsTri, long nombreFils)
+{
+	bool stable = ((optionsTri & CTableau::TriStable) != 0);
+	bool parallele = ((optionsTri & CTableau::TriParallele) != 0) && (nombreFils >= 2);
+	if (!stable && !parallele)
+	{
+		TrierIntrospectif(entites, nombre, comparateur);
+		return true;
+	}
+	// Le tampon doit pouvoir contenir toutes les entits pour un tri parallle, la moiti pour un tri stable en srie
+	T* tampon = (T*)malloc((parallele ? nombre : (nombre / 2 + 1)) * sizeof(T));
+	if (tampon == NULL)
+	{
+		if (stable) return false;
+		TrierIntrospectif(entites, nombre, comparateur);
+		return true;
+	}
+	if (!parallele || !TrierEnParallele(entites, nombre, comparateur, stable, nombreFils, tampon))
+	{
+		if (stable)
+		{
+			TrierParFusion(entites, nombre, comparateur, tampon);
+		}
+		else
+		{
+			TrierIntrospectif(entites, nombre, comparateur);
+		}
+	}
+	free(tampon);
+	return true;
+}
+
+/// <summary>
+/// Permet de trier les entits accompagnes de leurs cls de tri spcifies : par distribution successive des octets de leurs cls si l'option CTableau::TriParDistribution est demande, sinon comme toute autre plage
+/// <para>La distribution procde du premier octet vers les suivants (tri par base, octet de poids fort en premier), chaque paquet d'au moins deux cls tant ensuite distribu selon l'octet suivant, sans rcursivit ; elle est stable et se passe de comparaisons, hormis pour les petits paquets, tris par insertion</para>
+/// </summary>
+/// <param name="entites">Adresse du premier lment  trier</param>
+/// <param name="nombre">Nombre d'lments  trier</param>
+/// <param name="comparateur">Comparateur des cls de tri</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::TriStable, CTableau::TriParallele et CTableau::TriParDistribution)</param>
+/// <param name="nombreFils">Nombre de fils d'excution d'un tri parallle (1 pour un tri en srie), sans effet sur une distribution</param>
+/// <returns>Vrai si le tri est ralis, sinon faux (faute de mmoire pour un tri stable)</returns>
+static bool TrierPlageEntites(CEntiteCle* entites, long nombre, const CComparateurCles& comparateur, char optionsTri, long nombreFils)
+{
+	if (((optionsTri & CTableau::TriParDistribution) == 0) || (nombre <= SeuilTriParInsertion)) return TrierPlageEntites<CEntiteCle, CComparateurCles>(entites, nombre, comparateur, optionsTri, nombreFils);
+	// Les paquets restant  distribuer sont disjoints et comptent chacun au moins deux lments
+	CEntiteCle* tampon = (CEntiteCle*)malloc(nombre * sizeof(CEntiteCle));
+	CPlageCles* plages = (CPlageCles*)malloc((nombre / 2 + 1) * sizeof(CPlageCles));
+	if ((tampon == NULL) || (plages == NULL))
+	{
+		if (tampon != NULL) free(tampon);
+		if (plages != NULL) free(plages);
+		return TrierPlageEntites<CEntiteCle, CComparateurCles>(entites, nombre, comparateur, optionsTri, nombreFils);
+	}
+	long compteurs[257];
+	long nombrePlages = 1;
+	plages[0].m_Debut = 0;
+	plages[0].m_Nombre = nombre;
+	plages[0].m_Rang = 0;
+	while (nombrePlages > 0)
+	{
+		CPlageCles plage = plages[--nombrePlages];
+		CEntiteCle* elements = entites + plage.m_Debut;
+		if (plage.m_Nombre <= SeuilTriParInsertion)
+		{
+			TrierParInsertion(elements, plage.m_Nombre, comparateur);
+			continue;
+		}
+		// Dcompte des lments de chaque paquet, puis distribution stable des lments dans leurs paquets
+		memset(compteurs, 0, sizeof(compteurs));
+		long indice;
+		for (indice = 0; indice < plage.m_Nombre; indice++) compteurs[elements[indice].Paquet(plage.m_Rang)]++;
+		long position = 0;
+		for (int paquet = 0; paquet < 257; paquet++)
+		{
+			long nombreElements = compteurs[paquet];
+			compteurs[paquet] = position;
+			position += nombreElements;
+		}
+		for (indice = 0; indice < plage.m_Nombre; indice++) tampon[compteurs[elements[indice].Paquet(plage.m_Rang)]++] = elements[indice];
+		memcpy(elements, tampon, plage.m_Nombre * sizeof(CEntiteCle));
+		// Chaque compteur indique dsormais la fin de son paquet ; les cls du paquet 0, qui s'achvent toutes  ce rang, sont gales
+		for (int paquet = 1; paquet < 257; paquet++)
+		{
+			long nombreElements = compteurs[paquet] - compteurs[paquet - 1];
+			if (nombreElements < 2) continue;
+			plages[nombrePlages].m_Debut = plage.m_Debut + compteurs[paquet - 1];
+			plages[nombrePlages].m_Nombre = nombreElements;
+			plages[nombrePlages].m_Rang = plage.m_Rang + 1;
+			nombrePlages++;
+		}
+	}
+	free(plages);
+	free(tampon);
+	return true;
+}
+
+/// <summary>
+/// Permet de trier les adresses d'entits (ou les lments qui les accompagnent de leurs cls de tri) spcifies dont un prfixe est dj tri : seules les suivantes sont tries, avant d'tre fusionnes avec celui-ci
+/// <para>Le rsultat est identique  celui d'un tri de l'ensemble (y compris en tri stable, les entits du prfixe prcdant alors les entits gales qui le suivent)</para>
+/// </summary>
+/// <param name="entites">Adresse du premier lment  trier</param>
+/// <param name="nombre">Nombre d'entits  trier</param>
+/// <param name="debut">Nombre d'entits du prfixe dj tri</param>
+/// <param name="comparateur">Objet comparateur d'adresses d'entits</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::TriStable et CTableau::TriParallele)</param>
+/// <param name="nombreFils">Nombre de fils d'excution d'un tri parallle (1 pour un tri en srie)</param>
+/// <returns>Vrai si le tri est ralis, sinon faux (faute de mmoire)</returns>
+template <class T, class C> bool TrierEntites(T* entites, long nombre, long debut, const C& comparateur, char optionsTri, long nombreFils)
+{
+	if (debut <= 1) return TrierPlageEntites(entites, nombre, comparateur, optionsTri, nombreFils);
+	if (debut >= nombre) return true;
+	if (!TrierPlageEntites(entites + debut, nombre - debut, comparateur, optionsTri, nombreFils)) return false;
+	// Fusion inutile si la suite trie ne commence pas avant la fin du prfixe
+	if (comparateur(entites[debut], entites[debut - 1]) >= 0) return true;
+	T* tampon = (T*)malloc((nombre - debut) * sizeof(T));
+	if (tampon == NULL)
+	{
+		// Faute de mmoire pour la fusion, repli sur un tri complet (en place s'il n'a pas  tre stable)
+		if ((optionsTri & CTableau::TriStable) != 0) return false;
+		TrierIntrospectif(entites, nombre, comparateur);
+		return true;
+	}
+	FusionnerEnPlace(entites, nombre, debut, comparateur, tampon);
+	free(tampon);
+	return true;
+}
+
+/// <summary>
+/// Permet de trier les adresses d'entits spcifies dont un prfixe est dj tri (cf. TrierEntites), en calculant une seule fois la cl de tri de chaque entit (cf. CEntite::RepresentationOctets)
+/// </summary>
+/// <param name="entites">Adresse de la premire adresse d'entit  trier</param>
+/// <param name="nombre">Nombre d'entits  trier</param>
+/// <param name="debut">Nombre d'entits du prfixe dj tri</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::TriStable, CTableau::TriParallele et CTableau::TriParDistribution)</param>
+/// <param name="nombreFils">Nombre de fils d'excution d'un tri parallle (1 pour un tri en srie)</param>
+/// <returns>Vrai si le tri est ralis, sinon faux (type d'entit sans cl de tri selon cette modalit, ou manque de mmoire), les entits restant alors dans leur ordre initial</returns>
+static bool TrierEntitesParCles(CEntite** entites, long nombre, long debut, char modaliteComparaison, char optionsTri, long nombreFils)
+{
+	CEntiteCle* elements = (CEntiteCle*)malloc(nombre * sizeof(CEntiteCle));
+	if (elements == NULL) return false;
+	// Toutes les cls sont crites les unes  la suite des autres dans un mme tampon, agrandi au besoin (leurs positions n'y sont donc fixes qu'une fois toutes crites)
+	long taille = nombre * 16 + 8;
+	long utilise = 0;
+	unsigned char* cles = (unsigned char*)malloc(taille);
+	long indice;
+	for (indice = 0; (cles != NULL) && (indice < nombre); indice++)
+	{
+		long longueur = entites[indice]->RepresentationOctets(modaliteComparaison, cles + utilise, taille - utilise);
+		if (longueur < 0) break;
+		if (longueur > taille - utilise)
+		{
+			long nouvelleTaille = (taille * 2 > utilise + longueur) ? taille * 2 : utilise + longueur;
+			unsigned char* nouvellesCles = (unsigned char*)realloc(cles, nouvelleTaille);
+			if (nouvellesCles == NULL) break;
+			cles = nouvellesCles;
+			taille = nouvelleTaille;
+			entites[indice]->RepresentationOctets(modaliteComparaison, cles + utilise, taille - utilise);
+		}
+		elements[indice].m_Cle = (const unsigned char*)(size_t)utilise;
+		elements[indice].m_Longueur = longueur;
+		elements[indice].m_Entite = entites[indice];
+		utilise += longueur;
+	}
+	if ((cles == NULL) || (indice < nombre))
+	{
+		if (cles != NULL) free(cles);
+		free(elements);
+		return false;
+	}
+	for (indice = 0; indice < nombre; indice++)
+	{
+		CEntiteCle& element = elements[indice];
+		element.m_Cle = cles + (size_t)element.m_Cle;
+		// Prfixe des 8 premiers octets de la cl (complte par des octets nuls), lus dans l'ordre de poids dcroissant
+		element.m_Prefixe = 0;
+		for (long octet = 0; octet < 8; octet++) element.m_Prefixe = (element.m_Prefixe << 8) | ((octet < element.m_Longueur) ? element.m_Cle[octet] : 0);
+	}
+	bool resultat = TrierEntites(elements, nombre, debut, CComparateurCles(), optionsTri, nombreFils);
+	if (resultat)
+	{
+		for (indice = 0; indice < nombre; indice++) entites[indice] = elements[indice].m_Entite;
+	}
+	free(cles);
+	free(elements);
+	return resultat;
+}
+
+/// <summary>
+/// Permet de parcourir en une seule passe des adresses d'entits tries, par groupes contigus d'entits gales selon le comparateur, en cumulant pour chaque groupe les valeurs projetes de ses entits avant de le soumettre au traitement
+/// </summary>
+/// <param name="entites">Adresse du premier pointeur vers les entits tries</param>
+/// <param name="nombre">Nombre d'entits</param>
+/// <param name="comparateur">Objet comparateur d'adresses d'entits</param>
+/// <param name="traitement">Fonction appele pour chaque groupe, sinon NULL</param>
+/// <param name="contexteTraitement">Contexte transmis tel quel au traitement</param>
+/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+/// <param name="contexteProjection">Contexte transmis tel quel  la projection</param>
+/// <returns>Nombre de groupes soumis au traitement</returns>
+template <class C> long GrouperEntites(CEntite* const* entites, long nombre, const C& comparateur, CTableau::TraitementGroupe traitement, void* contexteTraitement, CTableau::ProjectionEntite projection, const void* contexteProjection)
+{
+	long nombreGroupes = 0;
+	CGroupeEntites groupe;
+	for (long indice = 0; indice < nombre; indice = groupe.m_IndiceDebut + groupe.m_Nombre)
+	{
+		groupe.m_Entites = entites + indice;
+		groupe.m_IndiceDebut = indice;
+		groupe.m_Somme = groupe.m_Minimum = groupe.m_Maximum = 0.0;
+		// Le groupe s'tend tant que les entits suivantes sont gales  sa premire entit
+		long indiceFin = indice;
+		do
+		{
+			if (projection != NULL)
+			{
+				double valeur = projection(*(entites[indiceFin]), contexteProjection);
+				if ((indiceFin == indice) || (valeur < groupe.m_Minimum)) groupe.m_Minimum = valeur;
+				if ((indiceFin == indice) || (valeur > groupe.m_Maximum)) groupe.m_Maximum = valeur;
+				groupe.m_Somme += valeur;
+			}
+			indiceFin++;
+		} while ((indiceFin < nombre) && (comparateur(entites[indice], entites[indiceFin]) == 0));
+		groupe.m_Nombre = indiceFin - indice;
+		nombreGroupes++;
+		if ((traitement != NULL) && !traitement(groupe, contexteTraitement)) break;
+	}
+	return nombreGroupes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// Constructeur spcifique
+/// </summary>
+/// <param name="entiteParDefaut">Modle d'entit par dfaut (c'est ce qui dtermine le "dnominateur commun"  tout lment que l'on veut placer dans ce tableau)</param>
+CTableau::CTableau(const CEntite& entiteParDefaut)
+	:m_Nombre(0), m_Taille(0), m_Tableau(NULL), m_TailleReservee(0), m_TriActuel(CTableau::NonTrie), m_NombreTries(0), m_TriMaintenu(false), m_NombreFilsTri(0), m_SeuilTriParallele(CTableau::SeuilTriParalleleParDefaut), m_EntiteParDefaut(entiteParDefaut.Cloner()), m_IndexHachage(NULL), m_IndexTri(NULL), m_Arene(NULL), m_CompteurPartage(NULL), m_Publication(NULL)
+{
+}
+
+/// <summary>
+/// Constructeur par copie
+/// <para>Les entits de la source ne sont pas clones : elles sont partages, jusqu' la premire modification de l'un des tableaux qui les partagent (cf. Detacher)</para>
+/// </summary>
+/// <param name="source">Entit source de cette copie</param>
+CTableau::CTableau(const CTableau& source)
+	:m_Nombre(0), m_Taille(0), m_Tableau(NULL), m_TailleReservee(0), m_TriActuel(CTableau::NonTrie), m_NombreTries(0), m_TriMaintenu(false), m_NombreFilsTri(source.m_NombreFilsTri), m_SeuilTriParallele(source.m_SeuilTriParallele), m_EntiteParDefaut(source.m_EntiteParDefaut->Cloner()), m_IndexHachage(NULL), m_IndexTri(NULL), m_Arene(NULL), m_CompteurPartage(NULL), m_Publication(NULL)
+{
+	// Partage du tableau des pointeurs, des entits et de l'arne de la source (sauf en mode concurrent, o ses lecteurs peuvent encore consulter des entits qu'elle a retires, et sauf si son tableau des pointeurs interne suffit, la copie tant alors aussi peu coteuse)
+	if ((source.m_Nombre > 0) && (source.m_Publication == NULL) && (source.m_Tableau != source.m_TableauInterne))
+	{
+		if (source.m_CompteurPartage == NULL)
+		{
+			// La source, constante, peut tre copie simultanment par plusieurs fils d'excution : seul le premier compteur install est retenu
+			long* compteur = (long*)malloc(sizeof(long));
+			if (compteur != NULL)
+			{
+				*compteur = 1;
+				if (InterlockedCompareExchangePointer((void* volatile*)&source.m_CompteurPartage, compteur, NULL) != NULL) free(compteur);
+			}
+		}
+		if (source.m_CompteurPartage != NULL)
+		{
+			InterlockedIncrement(source.m_CompteurPartage);
+			m_CompteurPartage = source.m_CompteurPartage;
+			m_Nombre = source.m_Nombre;
+			m_Taille = source.m_Taille;
+			m_Tableau = source.m_Tableau;
+			m_Arene = source.m_Arene;
+		}
+	}
+	if (m_CompteurPartage == NULL)
+	{
+		// A dfaut de partage, les entits de la source, dj valides et uniques, sont directement clones
+		if (source.m_Arene != NULL) ActiverArene();
+		if (Redimensionner(source.m_Nombre))
+		{
+			for (long indice = 0; indice < source.m_Nombre; indice++)
+			{
+				CEntite* entiteClonee = ClonerEntite(*(source.m_Tableau[indice]));
+				if (entiteClonee == NULL) break;
+				m_Tableau[m_Nombre++] = entiteClonee;
+			}
+		}
+	}
+	// Reprise des index de hachage et de tri de la source, construits en une seule fois  partir des entits
+	if (source.m_IndexHachage != NULL)
+	{
+		for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+		{
+			if (source.m_IndexHachage[modaliteComparaison] != NULL) ActiverIndexHachage(modaliteComparaison);
+		}
+	}
+	if (source.m_IndexTri != NULL)
+	{
+		for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+		{
+			if (source.m_IndexTri[modaliteComparaison] != NULL) ActiverIndexTri(modaliteComparaison);
+		}
+	}
+	m_TailleReservee = source.m_TailleReservee;
+	m_TriActuel = source.m_TriActuel;
+	m_NombreTries = (source.m_NombreTries < m_Nombre) ? source.m_NombreTries : m_Nombre;
+	m_TriMaintenu = source.m_TriMaintenu;
+}
+
+/// <summary>
+/// Destructeur
+/// </summary>
+CTableau::~CTableau()
+{
+	ActiverConcurrence(false);
+	Vider();
+	Redimensionner(0);
+	SupprimerIndexHachage();
+	SupprimerIndexTri();
+	if (m_Arene != NULL) delete m_Arene;
+	delete m_EntiteParDefaut;
+}
+
+/// <summary>
+/// Permet de crer un duplicata de cette entit
+/// </summary>
+/// <returns>Objet cr dynamiquement par clonage</returns>
+CEntite* CTableau::Cloner() const
+{
+	return new CTableau(*this);
+}
+
+/// <summary>
+/// Permet de supprimer toutes les entits du tableau
+/// </summary>
+void CTableau::Vider()
+{
+	if (m_CompteurPartage != NULL)
+	{
+		// Un tableau qui partage encore ses entits avec ses copies se contente de renoncer au partage, les entits restant la proprit des copies ; c'est la valeur retourne par la dcrmentation qui dsigne le dernier propritaire, les copies pouvant renoncer simultanment
+		if (InterlockedDecrement(m_CompteurPartage) == 0)
+		{
+			free((void*)m_CompteurPartage);
+		}
+		else
+		{
+			m_Nombre = 0;
+			m_Taille = 0;
+			m_Tableau = NULL;
+			if (m_Arene != NULL) m_Arene = new CArene();
+		}
+		m_CompteurPartage = NULL;
+	}
+	if (m_Publication != NULL)
+	{
+		// En mode concurrent, les entits sont seulement retires, et le tableau des pointeurs publi est conserv pour les lecteurs
+		for (long indice = 0; indice < m_Nombre; indice++) DetruireEntite(m_Tableau[indice]);
+		if (m_Tableau == m_Publication->Instantane()->m_Tableau)
+		{
+			m_Tableau = NULL;
+			m_Taille = 0;
+		}
+	}
+	else if (m_Arene != NULL)
+	{
+		// Les entits de l'arne sont seulement dtruites, ses blocs tant ensuite rendus en une seule fois
+		for (long indice = 0; indice < m_Nombre; indice++)
+		{
+			if (m_Arene->Contient(m_Tableau[indice]))
+			{
+				m_Tableau[indice]->~CEntite();
+			}
+			else
+			{
+				delete m_Tableau[indice];
+			}
+		}
+		m_Arene->Vider();
+	}
+	else
+	{
+		for (long indice = 0; indice < m_Nombre; indice++) delete m_Tableau[indice];
+	}
+	m_Nombre = 0;
+	// Le tableau des pointeurs n'est conserv qu' hauteur de la taille rserve
+	if (m_Taille != m_TailleReservee) Redimensionner(m_TailleReservee);
+	// Un tableau vide est trivialement tri : la modalit de tri maintenue par les ajouts (cf. MaintenirTri) est conserve
+	if (!m_TriMaintenu) m_TriActuel = CTableau::NonTrie;
+	m_NombreTries = 0;
+	if (m_IndexHachage != NULL)
+	{
+		for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+		{
+			if (m_IndexHachage[modaliteComparaison] != NULL) m_IndexHachage[modaliteComparaison]->Vider();
+		}
+	}
+	if (m_IndexTri != NULL)
+	{
+		for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+		{
+			if (m_IndexTri[modaliteComparaison] != NULL) m_IndexTri[modaliteComparaison]->Vider();
+		}
+	}
+	Publier();
+}
+
+/// <summary>
+/// Permet d'ajouter une nouvelle entit en fin de tableau,  partir du modle spcifi d'entit
+/// </summary>
+/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CTableau::Ajouter(const CEntite& entiteAAjouter)
+{
+	if (m_TriMaintenu && (TriActuel() != CTableau::NonTrie)) return InsererTrie(entiteAAjouter, m_TriActuel);
+	return Inserer(m_Nombre, entiteAAjouter);
+}
+
+/// <summary>
+/// Permet d'insrer une nouvelle entit  sa position dans l'ordre de tri selon la modalit de comparaison spcifie,  partir du modle spcifi d'entit
+/// <para>Le tableau est pralablement tri selon cette modalit si ncessaire ; il le reste aprs l'insertion, ce qui prserve les recherches dichotomiques</para>
+/// <para>Une entit gale  des entits dj prsentes est insre aprs celles-ci</para>
+/// </summary>
+/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'ordre de tri  respecter</param>
+/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+bool CTableau::InsererTrie(const CEntite& entiteAAjouter, char modaliteComparaison)
+{
+	if (!Trier(modaliteComparaison)) return false;
+	if (!Inserer(ChercherBorne(entiteAAjouter, modaliteComparaison, true, 0, m_Nombre), entiteAAjouter)) return false;
+	// L'insertion  la position de tri ne remet pas en cause l'tat actuel de tri
+	m_TriActuel = modaliteComparaison;
+	m_NombreTries = m_Nombre;
+	return true;
+}
+
+/// <summary>
+/// Permet d'indiquer si les ajouts en fin de tableau doivent plutt prserver l'tat actuel de tri, en insrant chaque nouvelle entit  sa position (cf. InsererTrie)
+/// <para>Sans effet tant que le tableau n'est pas tri ; Inserer, qui impose une position, n'est pas concerne ; un tableau vid reste tri selon la mme modalit, que les ajouts suivants maintiennent donc</para>
+/// </summary>
+/// <param name="maintien">Indique si l'tat actuel de tri doit tre maintenu par les ajouts</param>
+void CTableau::MaintenirTri(bool maintien)
+{
+	m_TriMaintenu = maintien;
+}
+
+/// <summary>
+/// Indique si les ajouts en fin de tableau prservent l'tat actuel de tri
+/// </summary>
+/// <returns>Vrai si l'tat actuel de tri est maintenu par les ajouts, sinon faux</returns>
+bool CTableau::TriMaintenu() const
+{
+	return m_TriMaintenu;
+}
+
+/// <summary>
+/// Permet d'insrer une nouvelle entit  la position spcifie du tableau,  partir du modle spcifi d'entit
+/// </summary>
+/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+bool CTableau::Inserer(long indiceInsertion, const CEntite& entiteAAjouter)
+{
+	// Les vrifications prcdent le clonage, qui n'a ainsi lieu que pour une entit effectivement insre
+	if (!PeutInserer(indiceInsertion, entiteAAjouter) || !Detacher(indiceInsertion)) return false;
+	return PlacerEntite(indiceInsertion, ClonerEntite(entiteAAjouter));
+}
+
+/// <summary>
+/// Permet d'ajouter une nouvelle entit en fin de tableau,  partir de l'entit temporaire spcifie, dont les ressources sont transfres (cf. ClonerParDeplacement)
+/// </summary>
+/// <param name="entiteAAjouter">Entit temporaire  ajouter dans le tableau</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CTableau::Ajouter(CEntite&& entiteAAjouter)
+{
+	if (m_TriMaintenu && (TriActuel() != CTableau::NonTrie)) return InsererTrie(entiteAAjouter, m_TriActuel);
+	return Inserer(m_Nombre, static_cast<CEntite&&>(entiteAAjouter));
+}
+
+/// <summary>
+/// Permet d'insrer une nouvelle entit  la position spcifie du tableau,  partir de l'entit temporaire spcifie, dont les ressources sont transfres (cf. ClonerParDeplacement)
+/// </summary>
+/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+/// <param name="entiteAAjouter">Entit temporaire  ajouter dans le tableau</param>
+/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+bool CTableau::Inserer(long indiceInsertion, CEntite&& entiteAAjouter)
+{
+	if (!PeutInserer(indiceInsertion, entiteAAjouter) || !Detacher(indiceInsertion)) return false;
+	return PlacerEntite(indiceInsertion, entiteAAjouter.ClonerParDeplacement());
+}
+
+/// <summary>
+/// Permet d'ajouter en fin de tableau l'entit spcifie, cre dynamiquement, sans la cloner : le tableau en devient propritaire
+/// <para>En cas d'chec, l'entit est dtruite</para>
+/// </summary>
+/// <param name="entiteAAdopter">Adresse de l'entit cre dynamiquement</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CTableau::Adopter(CEntite* entiteAAdopter)
+{
+	if (entiteAAdopter == NULL) return false;
+	if (m_TriMaintenu && (TriActuel() != CTableau::NonTrie))
+	{
+		// Insertion  la position de tri, comme le ferait InsererTrie
+		char modaliteComparaison = m_TriActuel;
+		if (!InsererAdopte(ChercherBorne(*entiteAAdopter, modaliteComparaison, true, 0, m_Nombre), entiteAAdopter)) return false;
+		m_TriActuel = modaliteComparaison;
+		m_NombreTries = m_Nombre;
+		return true;
+	}
+	return InsererAdopte(m_Nombre, entiteAAdopter);
+}
+
+/// <summary>
+/// Permet d'insrer  la position spcifie du tableau l'entit spcifie, cre dynamiquement, sans la cloner : le tableau en devient propritaire
+/// <para>En cas d'chec, l'entit est dtruite</para>
+/// </summary>
+/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+/// <param name="entiteAAdopter">Adresse de l'entit cre dynamiquement</param>
+/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+bool CTableau::InsererAdopte(long indiceInsertion, CEntite* entiteAAdopter)
+{
+	if (entiteAAdopter == NULL) return false;
+	if (!PeutInserer(indiceInsertion, *entiteAAdopter) || !Detacher(indiceInsertion))
+	{
+		delete entiteAAdopter;
+		return false;
+	}
+	return PlacerEntite(indiceInsertion, entiteAAdopter);
+}
+
+/// <summary>
+/// Permet d'ajouter en fin de tableau un lot d'entits,  partir des modles spcifis, avec le mme rsultat que des appels successifs  Ajouter
+/// <para>Les modles sont valids en une passe, puis les doublons (au sein du lot comme avec les entits dj prsentes) sont dtects par modalit d'unicit au moyen d'un seul tri du lot, avant un ajout en une seule rservation de capacit</para>
+/// </summary>
+/// <param name="entites">Adresse du tableau des adresses des modles d'entits  ajouter</param>
+/// <param name="nombre">Nombre de modles d'entits</param>
+/// <param name="rejetees">[RESULTAT] Adresse d'un tableau de nombre indicateurs, dont chacun indique si le modle correspondant a t rejet (invalide, doublon ou faute de mmoire), sinon NULL</param>
+/// <returns>Nombre d'entits ajoutes, sinon -1 (paramtres invalides ou faute de mmoire, aucune entit n'tant alors ajoute)</returns>
+long CTableau::AjouterLot(const CEntite* const* entites, long nombre, bool* rejetees)
+{
+	return PlacerLot(entites, nombre, rejetees, false);
+}
+
+/// <summary>
+/// Permet d'ajouter en fin de tableau un lot d'entits cres dynamiquement, sans les cloner, avec le mme rsultat que des appels successifs  Adopter : le tableau devient propritaire des entits retenues, les entits rejetes tant dtruites
+/// <para>Les entits sont traites comme par AjouterLot, leur validation et la dtection des doublons se faisant en une passe</para>
+/// </summary>
+/// <param name="entites">Adresse du tableau des adresses des entits cres dynamiquement</param>
+/// <param name="nombre">Nombre d'entits</param>
+/// <param name="rejetees">[RESULTAT] Adresse d'un tableau de nombre indicateurs, dont chacun indique si l'entit correspondante a t rejete (et dtruite), sinon NULL</param>
+/// <returns>Nombre d'entits adoptes, sinon -1 (paramtres invalides ou faute de mmoire, aucune entit n'tant alors ni adopte, ni dtruite)</returns>
+long CTableau::AdopterLot(CEntite* const* entites, long nombre, bool* rejetees)
+{
+	return PlacerLot(entites, nombre, rejetees, true);
+}
+
+/// <summary>
+/// Permet d'ajouter en fin de tableau un lot d'entits, clones ou adoptes (cf. AjouterLot et AdopterLot)
+/// </summary>
+/// <param name="entites">Adresse du tableau des adresses des entits ou modles d'entits</param>
+/// <param name="nombre">Nombre d'entits</param>
+/// <param name="rejetees">[RESULTAT] Adresse d'un tableau de nombre indicateurs de rejet, sinon NULL</param>
+/// <param name="adoption">Indique si les entits sont adoptes (les entits rejetes tant alors dtruites), sinon clones</param>
+/// <returns>Nombre d'entits ajoutes, sinon -1</returns>
+long CTableau::PlacerLot(const CEntite* const* entites, long nombre, bool* rejetees, bool adoption)
+{
+	if ((entites == NULL) || (nombre < 0)) return -1;
+	// Le lot se substitue  des ajouts successifs, y compris  leur insertion  la position de tri si l'tat de tri est maintenu
+	char triMaintenu = (m_TriMaintenu ? TriActuel() : CTableau::NonTrie);
+	// Validation en une passe
+	bool* refusees = (bool*)malloc((nombre + 1) * sizeof(bool));
+	if (refusees == NULL) return -1;
+	long nombreValides = 0;
+	for (long indice = 0; indice < nombre; indice++)
+	{
+		refusees[indice] = (entites[indice] == NULL) || !entites[indice]->EstValide(m_EntiteParDefaut);
+		if (!refusees[indice]) nombreValides++;
+	}
+	// Dtection des doublons, modalit d'unicit par modalit d'unicit
+	char nombreComparaisons = m_EntiteParDefaut->NombreComparaisons();
+	char nombreUnicites = 0;
+	for (char modaliteComparaison = 0; modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		if (m_EntiteParDefaut->EstComparaisonPourUnicite(modaliteComparaison)) nombreUnicites++;
+	}
+	if ((nombreUnicites > 0) && (nombreValides > 0))
+	{
+		// Pour chaque modalit d'unicit, chaque modle valide est associ au premier modle du lot qui lui est gal (son groupe), et chaque groupe est marqu pris ds qu'une entit gale est prsente ou ajoute
+		long* ordre = (long*)malloc(nombreValides * sizeof(long));
+		long* groupes = (long*)malloc(nombreUnicites * nombre * sizeof(long));
+		bool* pris = (bool*)calloc(nombreUnicites * nombre, sizeof(bool));
+		bool reussi = (ordre != NULL) && (groupes != NULL) && (pris != NULL);
+		for (char modaliteComparaison = 0, unicite = 0; reussi && (modaliteComparaison < nombreComparaisons); modaliteComparaison++)
+		{
+			if (!m_EntiteParDefaut->EstComparaisonPourUnicite(modaliteComparaison)) continue;
+			long* groupe = groupes + unicite * nombre;
+			bool* groupePris = pris + unicite * nombre;
+			unicite++;
+			// Tri unique du lot selon cette modalit (les modles gaux l'tant selon leur position dans le lot)
+			CComparateurLot comparateur(entites, m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison), modaliteComparaison);
+			long nombreOrdre = 0;
+			for (long indice = 0; indice < nombre; indice++)
+			{
+				if (!refusees[indice]) ordre[nombreOrdre++] = indice;
+			}
+			TrierIntrospectif(ordre, nombreOrdre, comparateur);
+			for (long rang = 0; rang < nombreOrdre; rang++)
+			{
+				groupe[ordre[rang]] = ((rang > 0) && (comparateur.Comparer(entites[ordre[rang - 1]], entites[ordre[rang]]) == 0)) ? groupe[ordre[rang - 1]] : ordre[rang];
+			}
+			// Doublons avec les entits dj prsentes : par l'index de hachage s'il existe, sinon par fusion avec les entits tries selon cette modalit
+			CIndexHachage* index = (m_IndexHachage != NULL) ? m_IndexHachage[modaliteComparaison] : NULL;
+			if (index != NULL)
+			{
+				for (long rang = 0; rang < nombreOrdre; rang++)
+				{
+					long indice = ordre[rang];
+					if (groupe[indice] != indice) continue;
+					const CEntite* entiteEgale;
+					groupePris[indice] = index->Rechercher(*(entites[indice]), entiteEgale) ? (entiteEgale != NULL) : (Rechercher(*(entites[indice]), modaliteComparaison) >= 0);
+				}
+			}
+			else if (m_Nombre > 0)
+			{
+				CEntite** existantes = m_Tableau;
+				if (!EstTrie(modaliteComparaison))
+				{
+					existantes = (CEntite**)malloc(m_Nombre * sizeof(CEntite*));
+					if (existantes == NULL)
+					{
+						reussi = false;
+						break;
+					}
+					memcpy(existantes, m_Tableau, m_Nombre * sizeof(CEntite*));
+					TrierIntrospectif(existantes, m_Nombre, comparateur);
+				}
+				long indiceExistante = 0;
+				for (long rang = 0; (rang < nombreOrdre) && (indiceExistante < m_Nombre); rang++)
+				{
+					long indice = ordre[rang];
+					if (groupe[indice] != indice) continue;
+					while ((indiceExistante < m_Nombre) && (comparateur.Comparer(existantes[indiceExistante], entites[indice]) < 0)) indiceExistante++;
+					groupePris[indice] = (indiceExistante < m_Nombre) && (comparateur.Comparer(existantes[indiceExistante], entites[indice]) == 0);
+				}
+				if (existantes != m_Tableau) free(existantes);
+			}
+		}
+		// Parcours dans l'ordre du lot : un modle n'est retenu que si aucun de ses groupes n'est pris, et prend alors chacun d'eux
+		for (long indice = 0; reussi && (indice < nombre); indice++)
+		{
+			if (refusees[indice]) continue;
+			for (char unicite = 0; unicite < nombreUnicites; unicite++)
+			{
+				if (pris[unicite * nombre + groupes[unicite * nombre + indice]]) refusees[indice] = true;
+			}
+			if (refusees[indice]) continue;
+			for (char unicite = 0; unicite < nombreUnicites; unicite++) pris[unicite * nombre + groupes[unicite * nombre + indice]] = true;
+		}
+		if (ordre != NULL) free(ordre);
+		if (groupes != NULL) free(groupes);
+		if (pris != NULL) free(pris);
+		if (!reussi)
+		{
+			free(refusees);
+			return -1;
+		}
+	}
+	// Ajout des modles retenus en fin de tableau, en une seule rservation de capacit
+	long nombreRetenus = 0;
+	for (long indice = 0; indice < nombre; indice++)
+	{
+		if (!refusees[indice]) nombreRetenus++;
+	}
+	long nombreInitial = m_Nombre;
+	if ((nombreRetenus > 0) && (!Detacher(m_Nombre) || (((m_Nombre + nombreRetenus) > m_Taille) && !Redimensionner(m_Nombre + nombreRetenus))))
+	{
+		// Faute de mmoire, rien n'est ajout, et aucune entit adopte n'est dtruite : l'appelant en reste propritaire
+		free(refusees);
+		return -1;
+	}
+	for (long indice = 0; (nombreRetenus > 0) && (indice < nombre); indice++)
+	{
+		if (refusees[indice]) continue;
+		// Une entit adopte, dj valide, est place telle quelle
+		CEntite* entiteClonee = adoption ? const_cast<CEntite*>(entites[indice]) : ClonerEntite(*(entites[indice]));
+		if (!adoption && ((entiteClonee == NULL) || !entiteClonee->EstValide(m_EntiteParDefaut)))
+		{
+			if (entiteClonee != NULL) DetruireEntite(entiteClonee);
+			refusees[indice] = true;
+			continue;
+		}
+		m_Tableau[m_Nombre++] = entiteClonee;
+		// Les index de hachage sont aliments au fil de l'eau, les index de tri tant reconstruits en une seule fois
+		for (char modaliteComparaison = 0; (m_IndexHachage != NULL) && (modaliteComparaison < nombreComparaisons); modaliteComparaison++)
+		{
+			CIndexHachage* index = m_IndexHachage[modaliteComparaison];
+			if ((index != NULL) && !index->Ajouter(entiteClonee))
+			{
+				delete index;
+				m_IndexHachage[modaliteComparaison] = NULL;
+			}
+		}
+	}
+	if (m_Nombre > nombreInitial)
+	{
+		ReconstruireIndexTri();
+		// Le prfixe tri s'allonge tant que les entits ajoutes s'y placent dans l'ordre
+		if ((m_TriActuel != CTableau::NonTrie) && (m_NombreTries == nombreInitial))
+		{
+			while ((m_NombreTries < m_Nombre) && ((m_NombreTries == 0) || (m_Tableau[m_NombreTries - 1]->Comparer(*(m_Tableau[m_NombreTries]), m_TriActuel) <= 0))) m_NombreTries++;
+		}
+		// Un tri stable quivaut  l'insertion successive de chaque entit aprs celles qui lui sont gales (cf. InsererTrie)
+		if (triMaintenu != CTableau::NonTrie) Trier(triMaintenu, CTableau::TriStable);
+	}
+	// Les entits adoptes qui n'ont pas t retenues sont dtruites, comme par Adopter
+	for (long indice = 0; adoption && (indice < nombre); indice++)
+	{
+		if (refusees[indice] && (entites[indice] != NULL)) delete entites[indice];
+	}
+	if (rejetees != NULL) memcpy(rejetees, refusees, nombre * sizeof(bool));
+	free(refusees);
+	if (m_Nombre > nombreInitial) Publier();
+	return m_Nombre - nombreInitial;
+}
+
+/// <summary>
+/// Indique si l'entit spcifie peut tre insre  la position spcifie du tableau (position, validit et unicits)
+/// </summary>
+/// <param name="indiceInsertion">Indice d'insertion</param>
+/// <param name="entiteAAjouter">Entit  insrer</param>
+/// <returns>Vrai si l'insertion est possible, sinon faux</returns>
+bool CTableau::PeutInserer(long indiceInsertion, const CEntite& entiteAAjouter) const
+{
+	// Vrifier la validit des paramtres
+	if ((indiceInsertion < 0) || (indiceInsertion > m_Nombre)) return false;
+	if (!entiteAAjouter.EstValide(m_EntiteParDefaut)) return false;
+	// Vrifier la ou les unicits  tester
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		if (m_EntiteParDefaut->EstComparaisonPourUnicite(modaliteComparaison))
+		{
+			const CEntite* entiteEgale;
+			if ((m_IndexHachage != NULL) && (m_IndexHachage[modaliteComparaison] != NULL) && m_IndexHachage[modaliteComparaison]->Rechercher(entiteAAjouter, entiteEgale))
+			{
+				if (entiteEgale != NULL) return false;
+			}
+			else if (Rechercher(entiteAAjouter, modaliteComparaison) >= 0) return false;
+		}
+	}
+	return true;
+}
+
+/// <summary>
+/// Permet de mettre fin au partage des entits de ce tableau avec ses copies, en clonant les entits partages (sans les revalider, ni tester leur unicit)
+/// <para>Doit prcder toute modification du tableau des pointeurs ou des entits, ainsi que tout clonage dans l'arne ; en mode concurrent, le tableau des pointeurs publi est alors remplac par une copie s'il doit tre modifi en de du nombre d'entits publies</para>
+/// </summary>
+/// <param name="indiceModification">Indice de la premire case du tableau des pointeurs  modifier (le nombre d'entits pour un simple ajout en fin de tableau)</param>
+/// <returns>Vrai si ce tableau ne partage plus ses entits, sinon faux (faute de mmoire, le partage tant alors maintenu)</returns>
+bool CTableau::Detacher(long indiceModification)
+{
+	// En mode concurrent (o aucune entit n'est partage), le tableau des pointeurs publi ne peut tre modifi qu'au-del du nombre d'entits publies
+	if (m_Publication != NULL)
+	{
+		const CInstantaneTableau* instantane = m_Publication->Instantane();
+		if ((m_Tableau == NULL) || (instantane->m_Tableau != m_Tableau) || (indiceModification >= instantane->m_Nombre)) return true;
+		CEntite** tableau = (CEntite**)malloc(m_Taille * sizeof(CEntite*));
+		if (tableau == NULL) return false;
+		memcpy(tableau, m_Tableau, m_Nombre * sizeof(CEntite*));
+		m_Tableau = tableau;
+		return true;
+	}
+	if (m_CompteurPartage == NULL) return true;
+	// Le dernier tableau  partager les entits en redevient simplement le seul propritaire
+	if (*m_CompteurPartage == 1)
+	{
+		free((void*)m_CompteurPartage);
+		m_CompteurPartage = NULL;
+		return true;
+	}
+	CEntite** tableau = (CEntite**)malloc(m_Taille * sizeof(CEntite*));
+	if (tableau == NULL) return false;
+	CEntite** tableauPartage = m_Tableau;
+	CArene* arenePartagee = m_Arene;
+	if (arenePartagee != NULL) m_Arene = new CArene();
+	long indice;
+	for (indice = 0; indice < m_Nombre; indice++)
+	{
+		tableau[indice] = ClonerEntite(*(tableauPartage[indice]));
+		if (tableau[indice] == NULL) break;
+	}
+	if (indice < m_Nombre)
+	{
+		// Faute de mmoire, abandon des clones dj crs et maintien du partage
+		while (indice > 0) DetruireEntite(tableau[--indice]);
+		if (m_Arene != arenePartagee) delete m_Arene;
+		m_Arene = arenePartagee;
+		free(tableau);
+		return false;
+	}
+	// Une autre copie a pu renoncer au partage entre-temps : si ce tableau s'avre en tre le dernier propritaire, il garde les entits partages plutt que ses clones
+	if (InterlockedDecrement(m_CompteurPartage) == 0)
+	{
+		free((void*)m_CompteurPartage);
+		m_CompteurPartage = NULL;
+		for (indice = 0; indice < m_Nombre; indice++) DetruireEntite(tableau[indice], true);
+		if (m_Arene != arenePartagee) delete m_Arene;
+		m_Arene = arenePartagee;
+		free(tableau);
+		return true;
+	}
+	m_CompteurPartage = NULL;
+	m_Tableau = tableau;
+	// Les index de tri retiennent des indices, inchangs, alors que les index de hachage retiennent les adresses des entits
+	ReconstruireIndexHachage();
+	return true;
+}
+
+/// <summary>
+/// Permet d'achever une suppression d'entits en bloc : remise  NULL des cases libres, rduction unique du tableau des pointeurs, ou retour  l'tat initial s'il est vide, et reconstruction des index de tri
+/// </summary>
+/// <param name="ancienNombre">Nombre d'entits avant la suppression</param>
+void CTableau::TerminerSuppressions(long ancienNombre)
+{
+	if (m_Nombre >= 1)
+	{
+		// Remise  NULL des pointeurs stocks dans les cases libres
+		memset(m_Tableau + m_Nombre, 0, (ancienNombre - m_Nombre) * sizeof(CEntite*));
+		// Mme rgle de rduction que Supprimer, mais applique en une seule rallocation
+		long nouvelleTaille = m_Taille;
+		while ((m_Nombre < (nouvelleTaille / 4)) && (nouvelleTaille > m_TailleReservee)) nouvelleTaille /= 2;
+		if (nouvelleTaille < m_TailleReservee) nouvelleTaille = m_TailleReservee;
+		if (nouvelleTaille != m_Taille) Redimensionner(nouvelleTaille);
+	}
+	else
+	{
+		// Retour  l'tat initial du tableau (hormis la taille rserve, qui est conserve), l'arne ventuelle rendant alors tous ses blocs
+		if (m_TailleReservee == 0) Redimensionner(0);
+		else memset(m_Tableau, 0, ancienNombre * sizeof(CEntite*));
+		if ((m_Arene != NULL) && (m_Publication == NULL)) m_Arene->Vider();
+		// Un tableau vide est trivialement tri : la modalit de tri maintenue par les ajouts (cf. MaintenirTri) est conserve
+		if (!m_TriMaintenu) m_TriActuel = CTableau::NonTrie;
+		m_NombreTries = 0;
+	}
+	// Les index de tri retiennent des indices, dcals par la suppression
+	ReconstruireIndexTri();
+	Publier();
+}
+
+/// <summary>
+/// Permet de placer  la position spcifie du tableau l'entit spcifie, dont le tableau devient propritaire, les vrifications d'unicit ayant dj t faites et le tableau n'tant plus partag
+/// <para>En cas d'chec, l'entit est dtruite</para>
+/// </summary>
+/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+/// <param name="entite">Adresse de l'entit cre dynamiquement, sinon NULL (chec)</param>
+/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+bool CTableau::PlacerEntite(long indiceInsertion, CEntite* entite)
+{
+	if (entite == NULL) return false;
+	if (!entite->EstValide(m_EntiteParDefaut))
+	{
+		DetruireEntite(entite);
+		return false;
+	}
+	// Ajustement si ncessaire de la taille du tableau des pointeurs (croissance gomtrique, afin qu'un chargement de n entits ne cote que O(log n) rallocations)
+	if (m_Nombre == m_Taille)
+	{
+		long nouvelleTaille = (m_Taille < CTableau::TailleMinimale) ? CTableau::TailleMinimale : (m_Taille * 2);
+		if (nouvelleTaille < m_TailleReservee) nouvelleTaille = m_TailleReservee;
+		if (!Redimensionner(nouvelleTaille))
+		{
+			DetruireEntite(entite);
+			return false;
+		}
+	}
+	// Dcalage des pointeurs vers les lments, d'une position vers la position suivante, et ce,  partir de la position d'insertion
+	if (indiceInsertion < m_Nombre)
+	{
+		memmove(m_Tableau + (indiceInsertion + 1), m_Tableau + indiceInsertion, (m_Nombre - indiceInsertion) * sizeof(CEntite*));
+	}
+	// Copie de l'adresse de la nouvelle entit  la position spcifie
+	m_Tableau[indiceInsertion] = entite;
+	// Incrmentation du nombre d'lments
+	m_Nombre++;
+	// Rfrencement de la nouvelle entit dans les index de hachage et de tri
+	IndexerEntite(indiceInsertion);
+	// Le prfixe tri s'allonge si la nouvelle entit y prend place dans l'ordre (notamment un ajout en fin de tableau tri, s'il n'est pas infrieur au dernier lment) ; sinon, il est tronqu  la position d'insertion
+	if ((m_TriActuel != CTableau::NonTrie) && (indiceInsertion <= m_NombreTries))
+	{
+		bool dansOrdre = ((indiceInsertion == 0) || (m_Tableau[indiceInsertion - 1]->Comparer(*entite, m_TriActuel) <= 0))
+			&& ((indiceInsertion == m_NombreTries) || (entite->Comparer(*(m_Tableau[indiceInsertion + 1]), m_TriActuel) <= 0));
+		m_NombreTries = dansOrdre ? (m_NombreTries + 1) : indiceInsertion;
+	}
+	Publier();
+	// Indication de russite de l'insertion
+	return true;
+}
+
+/// <summary>
+/// Permet de crer un clone de l'entit spcifie, dans l'arne de ce tableau si possible, sinon par Cloner
+/// </summary>
+/// <param name="modele">Entit  cloner</param>
+/// <returns>Adresse du clone, sinon NULL</returns>
+CEntite* CTableau::ClonerEntite(const CEntite& modele)
+{
+	if (m_Arene != NULL)
+	{
+		long taille = modele.TailleObjet();
+		void* adresse = m_Arene->Allouer(taille);
+		if (adresse != NULL)
+		{
+			CEntite* entiteClonee = modele.ClonerDans(adresse);
+			if (entiteClonee != NULL) return entiteClonee;
+			m_Arene->Liberer(adresse, taille);
+		}
+	}
+	return modele.Cloner();
+}
+
+/// <summary>
+/// Permet de dtruire l'entit spcifie, qu'elle soit alloue dans l'arne de ce tableau ou individuellement
+/// <para>En mode concurrent, l'entit est seulement retire, et ne sera dtruite qu'une fois rcuprable (cf. Publier)</para>
+/// </summary>
+/// <param name="entite">Adresse de l'entit  dtruire</param>
+/// <param name="immediatement">Indique si l'entit doit tre dtruite immdiatement, mme en mode concurrent</param>
+void CTableau::DetruireEntite(CEntite* entite, bool immediatement)
+{
+	if (!immediatement && (m_Publication != NULL))
+	{
+		m_Publication->Retirer(entite);
+		return;
+	}
+	if ((m_Arene != NULL) && m_Arene->Contient(entite))
+	{
+		// La taille est releve avant la destruction, qui rend l'appel virtuel impossible
+		long taille = entite->TailleObjet();
+		entite->~CEntite();
+		m_Arene->Liberer(entite, taille);
+	}
+	else
+	{
+		delete entite;
+	}
+}
+
+/// <summary>
+/// Permet de supprimer l'entit spcifie du tableau
+/// </summary>
+/// <param name="indiceElement">Indice de l'lment  supprimer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
+bool CTableau::Supprimer(long indiceElement)
+{
+	// Vrifier la validit des paramtres
+	if ((indiceElement < 0) || (indiceElement >= m_Nombre)) return false;
+	if (!Detacher(indiceElement)) return false;
+	// Suppression de l'lment spcifi par son indice
+	DesindexerEntite(indiceElement);
+	DetruireEntite(m_Tableau[indiceElement]);
+	// Dcalage des pointeurs vers les lments, d'une position vers la position prcdente, et ce,  partir de la position suivant celle de suppression
+	if (indiceElement < (m_Nombre - 1))
+	{
+		memmove(m_Tableau + indiceElement, m_Tableau + (indiceElement + 1), ((m_Nombre - 1) - indiceElement) * sizeof(CEntite*));
+	}
+	// Dcrmentation du nombre d'lments (la suppression d'un lment du prfixe tri le laisse tri)
+	m_Nombre--;
+	if (indiceElement < m_NombreTries) m_NombreTries--;
+	if (m_Nombre >= 1)
+	{
+		// Remise  NULL du pointeur stock dans la case suivante du dernier lment
+		m_Tableau[m_Nombre] = NULL;
+		// Optionnellement, on rduit de moiti la taille effective du tableau de pointeurs quand il n'est plus occup qu'au quart (cet cart vite qu'une alternance de suppressions et d'ajouts ne provoque une rallocation  chaque opration), sans jamais descendre sous la taille rserve
+		if ((m_Nombre < (m_Taille / 4)) && (m_Taille > m_TailleReservee))
+		{
+			long nouvelleTaille = m_Taille / 2;
+			if (nouvelleTaille < m_TailleReservee) nouvelleTaille = m_TailleReservee;
+			Redimensionner(nouvelleTaille);
+		}
+	}
+	else
+	{
+		// Comme on vient de supprimer le tout dernier lment, on revient dans l'tat initial du tableau (hormis la taille rserve, qui est conserve)
+		if (m_TailleReservee == 0) Redimensionner(0);
+		// Un tableau vide est trivialement tri : la modalit de tri maintenue par les ajouts (cf. MaintenirTri) est conserve
+		if (!m_TriMaintenu) m_TriActuel = CTableau::NonTrie;
+		m_NombreTries = 0;
+	}
+	Publier();
+	// Indication de russite de la suppression
+	return true;
+}
+
+/// <summary>
+/// Permet de supprimer du tableau, en un seul parcours, toutes les entits vrifiant le prdicat spcifi
+/// <para>Les entits conserves gardent leur ordre relatif, si bien que l'tat actuel de tri est prserv ; le tableau des pointeurs n'est rduit qu'une fois,  la fin</para>
+/// </summary>
+/// <param name="predicat">Fonction indiquant si une entit doit tre supprime</param>
+/// <param name="contexte">Contexte transmis tel quel au prdicat  chaque appel</param>
+/// <returns>Nombre d'entits supprimes, sinon -1 (paramtre invalide ou manque de mmoire)</returns>
+long CTableau::SupprimerSi(PredicatEntite predicat, const void* contexte)
+{
+	// Vrifier la validit des paramtres
+	if (predicat == NULL) return -1;
+	// Recherche de la premire entit  supprimer, sans dtacher le tableau s'il n'y en a aucune
+	long indiceLecture = 0;
+	while ((indiceLecture < m_Nombre) && !predicat(*(m_Tableau[indiceLecture]), contexte)) indiceLecture++;
+	if (indiceLecture == m_Nombre) return 0;
+	if (!Detacher()) return -1;
+	// Compactage des pointeurs conservs vers le dbut du tableau, les entits supprimes tant retires des index de hachage puis dtruites au fil du parcours
+	long ancienNombre = m_Nombre;
+	long nombreTries = (indiceLecture < m_NombreTries) ? indiceLecture : m_NombreTries;
+	long indiceEcriture = indiceLecture;
+	for (; indiceLecture < ancienNombre; indiceLecture++)
+	{
+		CEntite* entite = m_Tableau[indiceLecture];
+		// La premire entit  supprimer (seule  avoir le mme indice de lecture et d'criture) a dj t teste
+		if ((indiceLecture > indiceEcriture) && !predicat(*entite, contexte))
+		{
+			m_Tableau[indiceEcriture++] = entite;
+			if (indiceLecture < m_NombreTries) nombreTries++;
+			continue;
+		}
+		if (m_IndexHachage != NULL)
+		{
+			for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+			{
+				if (m_IndexHachage[modaliteComparaison] != NULL) m_IndexHachage[modaliteComparaison]->Retirer(entite);
+			}
+		}
+		DetruireEntite(entite);
+	}
+	// Une suppression ne modifiant pas l'ordre relatif des entits conserves, celles issues du prfixe tri le restent
+	m_Nombre = indiceEcriture;
+	m_NombreTries = nombreTries;
+	TerminerSuppressions(ancienNombre);
+	return ancienNombre - m_Nombre;
+}
+
+/// <summary>
+/// Permet de supprimer du tableau toutes les entits d'une plage d'indices, avec un seul dcalage des entits suivantes
+/// <para>L'tat actuel de tri est prserv</para>
+/// </summary>
+/// <param name="indiceDebut">Indice de la premire entit  supprimer<para>Compris entre 0 et le nombre d'entits</para></param>
+/// <param name="indiceFin">Indice suivant celui de la dernire entit  supprimer<para>Compris entre l'indice de dbut et le nombre d'entits</para></param>
+/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
+bool CTableau::SupprimerPlage(long indiceDebut, long indiceFin)
+{
+	// Vrifier la validit des paramtres
+	if ((indiceDebut < 0) || (indiceFin < indiceDebut) || (indiceFin > m_Nombre)) return false;
+	if (indiceDebut == indiceFin) return true;
+	if (!Detacher()) return false;
+	// Suppression des entits de la plage
+	for (long indiceElement = indiceDebut; indiceElement < indiceFin; indiceElement++)
+	{
+		if (m_IndexHachage != NULL)
+		{
+			for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+			{
+				if (m_IndexHachage[modaliteComparaison] != NULL) m_IndexHachage[modaliteComparaison]->Retirer(m_Tableau[indiceElement]);
+			}
+		}
+		DetruireEntite(m_Tableau[indiceElement]);
+	}
+	// Dcalage en une fois des pointeurs vers les lments suivant la plage
+	if (indiceFin < m_Nombre)
+	{
+		memmove(m_Tableau + indiceDebut, m_Tableau + indiceFin, (m_Nombre - indiceFin) * sizeof(CEntite*));
+	}
+	long ancienNombre = m_Nombre;
+	m_Nombre -= indiceFin - indiceDebut;
+	if (indiceFin <= m_NombreTries) m_NombreTries -= indiceFin - indiceDebut;
+	else if (indiceDebut < m_NombreTries) m_NombreTries = indiceDebut;
+	TerminerSuppressions(ancienNombre);
+	return true;
+}
+
+/// <summary>
+/// Permet de s'assurer que le tableau des pointeurs peut contenir au moins le nombre spcifi d'entits, sans nouvelle rallocation
+/// <para>Cette taille rserve est conserve par la suite : les suppressions ne rduisent jamais le tableau des pointeurs en de</para>
+/// </summary>
+/// <param name="nombre">Nombre d'entits  pouvoir contenir</param>
+/// <returns>Vrai si la rservation a pu se faire, sinon faux</returns>
+bool CTableau::Reserver(long nombre)
+{
+	if (nombre < 0) return false;
+	if ((nombre > m_Taille) && (!Detacher(m_Nombre) || !Redimensionner(nombre))) return false;
+	m_TailleReservee = nombre;
+	Publier();
+	return true;
+}
+
+/// <summary>
+/// Permet de rduire le tableau des pointeurs au strict nombre actuel d'entits, en annulant toute taille rserve
+/// </summary>
+/// <returns>Vrai si le compactage a pu se faire, sinon faux</returns>
+bool CTableau::Compacter()
+{
+	m_TailleReservee = 0;
+	if (m_Taille == m_Nombre) return true;
+	if (!Detacher(m_Nombre) || !Redimensionner(m_Nombre)) return false;
+	Publier();
+	return true;
+}
+
+/// <summary>
+/// Accesseur de la taille actuelle du tableau des pointeurs
+/// </summary>
+/// <returns>Nombre d'entits que le tableau peut contenir sans nouvelle rallocation</returns>
+long CTableau::Capacite() const
+{
+	return m_Taille;
+}
+
+/// <summary>
+/// Permet de modifier la taille effective du tableau des pointeurs
+/// <para>Une taille au plus gale  TailleInterne est servie par le tableau des pointeurs interne, hors partage et hors mode concurrent</para>
+/// </summary>
+/// <param name="nouvelleTaille">Nouvelle taille du tableau des pointeurs<para>Au moins gale au nombre actuel d'entits</para></param>
+/// <returns>Vrai si le redimensionnement a pu se faire, sinon faux</returns>
+bool CTableau::Redimensionner(long nouvelleTaille)
+{
+	if (nouvelleTaille < m_Nombre) return false;
+	// Le tableau des pointeurs publi en mode concurrent, que des lecteurs peuvent consulter, n'est ni libr ni rallou, mais remplac (cf. Publier)
+	bool publie = (m_Publication != NULL) && (m_Tableau != NULL) && (m_Tableau == m_Publication->Instantane()->m_Tableau);
+	bool interne = (m_Tableau == m_TableauInterne);
+	if (nouvelleTaille == 0)
+	{
+		if ((m_Tableau != NULL) && !publie && !interne) free(m_Tableau);
+		m_Tableau = NULL;
+		m_Taille = 0;
+		return true;
+	}
+	// Le tableau des pointeurs interne, modifi sur place, n'est jamais publi (cf. ActiverConcurrence)
+	if ((nouvelleTaille <= CTableau::TailleInterne) && (m_Publication == NULL))
+	{
+		if (!interne)
+		{
+			if (m_Nombre > 0) memcpy(m_TableauInterne, m_Tableau, m_Nombre * sizeof(CEntite*));
+			if (m_Tableau != NULL) free(m_Tableau);
+			m_Tableau = m_TableauInterne;
+		}
+		m_Taille = CTableau::TailleInterne;
+		return true;
+	}
+	void* nouvelleAdresse;
+	if (publie || interne)
+	{
+		nouvelleAdresse = malloc(nouvelleTaille * sizeof(CEntite*));
+		if (nouvelleAdresse != NULL) memcpy(nouvelleAdresse, m_Tableau, m_Nombre * sizeof(CEntite*));
+	}
+	else
+	{
+		nouvelleAdresse = (m_Tableau == NULL) ? malloc(nouvelleTaille * sizeof(CEntite*)) : realloc(m_Tableau, nouvelleTaille * sizeof(CEntite*));
+	}
+	if (nouvelleAdresse == NULL) return false;
+	m_Tableau = (CEntite**)nouvelleAdresse;
+	m_Taille = nouvelleTaille;
+	return true;
+}
+
+/// <summary>
+/// Fonction de comparaison compatible avec le callback de la fonction lfind_c
+/// </summary>
+/// <param name="adresseEntite">Adresse d'un emplacement contenant l'adresse d'une entit</param>
+/// <param name="adresseAutreEntite">Adresse d'un autre emplacement contenant l'adresse d'une autre entit</param>
+/// <param name="contexte">Adresse du contexte de callback</param>
+/// <returns>-1 si l'entit est "infrieure"  l'autre entit, 1 si l'entit est "suprieure"  l'autre entit, sinon 0 (en cas d'galit)</returns>
+/*static*/ int CTableau::Comparer(const void* adresseEntite, const void* adresseAutreEntite, const void* contexte)
+{
+	const CEntite& entite = *(*((const CEntite**)adresseEntite));
+	const CEntite& autreEntite = *(*((const CEntite**)adresseAutreEntite));
+	char modaliteComparaison = *((const char*)contexte);
+	return entite.Comparer(autreEntite, modaliteComparaison);
+}
+
+/// <summary>
+/// Recherche dichotomique d'une borne, dans une plage d'entits trie selon la modalit de comparaison spcifie
+/// </summary>
+/// <param name="entite">Modle de l'entit dont on cherche la borne</param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle la plage est trie</param>
+/// <param name="borneSuperieure">Indique si l'on cherche la borne suprieure (premire entit strictement plus grande) plutt que la borne infrieure (premire entit plus grande ou gale)</param>
+/// <param name="indiceDebut">Indice de la premire entit de la plage</param>
+/// <param name="indiceFin">Indice suivant celui de la dernire entit de la plage</param>
+/// <returns>Indice de la borne, compris entre indiceDebut et indiceFin</returns>
+long CTableau::ChercherBorne(const CEntite& entite, char modaliteComparaison, bool borneSuperieure, long indiceDebut, long indiceFin) const
+{
+	while (indiceDebut < indiceFin)
+	{
+		long indiceMilieu = indiceDebut + (indiceFin - indiceDebut) / 2;
+		int resultat = entite.Comparer(*(m_Tableau[indiceMilieu]), modaliteComparaison);
+		if ((resultat > 0) || (borneSuperieure && (resultat == 0)))
+		{
+			indiceDebut = indiceMilieu + 1;
+		}
+		else
+		{
+			indiceFin = indiceMilieu;
+		}
+	}
+	return indiceDebut;
+}
+
+/// <summary>
+/// Permet de trier les entits selon la modalit de comparaison spcifie
+/// <para>Si seules les dernires entits ont t ajoutes depuis un tri selon cette modalit, elles seules sont tries, puis fusionnes en temps linaire avec le prfixe dj tri</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors du tri des entits</param>
+/// <param name="optionsTri">Combinaison d'options de tri (TriStable, TriParallele, TriParCles, TriParDistribution)<para>Un tri stable parallle produit exactement le mme ordre qu'un tri stable en srie</para></param>
+/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+bool CTableau::Trier(char modaliteComparaison, char optionsTri)
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+	if (EstTrie(modaliteComparaison)) return true;
+	if (m_Nombre >= 2)
+	{
+		if (!Detacher()) return false;
+		// Seules les entits qui suivent le prfixe dj tri selon cette modalit sont  trier
+		long debut = (modaliteComparaison == m_TriActuel) ? m_NombreTries : 0;
+		if (!TrierAdresses(m_Tableau, m_Nombre, debut, modaliteComparaison, optionsTri)) return false;
+		// Les indices retenus par les index de tri ne correspondent plus aux entits
+		ReconstruireIndexTri();
+	}
+	// Indication de russite du tri
+	m_TriActuel = modaliteComparaison;
+	m_NombreTries = m_Nombre;
+	Publier();
+	return true;
+}
+
+/// <summary>
+/// Permet de trier, selon la modalit de comparaison spcifie, un tableau d'adresses d'entits de ce tableau (cf. CVueTableau) dont un prfixe est ventuellement dj tri, sans modifier ce tableau ni ses entits
+/// <para>Le tri procde comme celui du tableau lui-mme (fonction de comparaison directe, cls de tri et paralllisme selon les options)</para>
+/// </summary>
+/// <param name="entites">Adresse du tableau des adresses d'entits  trier</param>
+/// <param name="nombre">Nombre d'adresses d'entits</param>
+/// <param name="debut">Nombre d'adresses du prfixe dj tri selon cette modalit</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <param name="optionsTri">Combinaison d'options de tri (TriStable, TriParallele, TriParCles, TriParDistribution)</param>
+/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+bool CTableau::TrierAdresses(CEntite** entites, long nombre, long debut, char modaliteComparaison, char optionsTri) const
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+	if (nombre < 2) return true;
+	if ((debut < 0) || (debut > nombre)) debut = 0;
+	long nombreFils = NombreFilsTri(nombre - debut, optionsTri);
+	// Tri sur les cls de tri (ventuellement par distribution) si elles sont demandes et que le type d'entit en propose, sinon par la fonction de comparaison directe du type d'entit s'il en propose une (ce qui vite l'appel virtuel et la slection de la modalit  chaque comparaison)
+	if (((optionsTri & (CTableau::TriParCles | CTableau::TriParDistribution)) != 0) && TrierEntitesParCles(entites, nombre, debut, modaliteComparaison, optionsTri, nombreFils)) return true;
+	CEntite::ComparateurEntites comparateur = m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison);
+	return (comparateur != NULL)
+		? TrierEntites(entites, nombre, debut, CComparateurDirect(comparateur), optionsTri, nombreFils)
+		: TrierEntites(entites, nombre, debut, CComparateurVirtuel(modaliteComparaison), optionsTri, nombreFils);
+}
+
+/// <summary>
+/// Permet de parcourir le tableau par groupes d'entits gales selon la modalit de comparaison spcifie, en une seule passe aprs un tri selon celle-ci (sans tri s'il est dj tri ainsi)
+/// <para>Chaque groupe est soumis au traitement avec son effectif et, si une projection est spcifie, la somme, le minimum et le maximum des valeurs projetes de ses entits ; le traitement ne doit pas modifier le tableau</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'galit des entits d'un groupe</param>
+/// <param name="traitement">Fonction appele pour chaque groupe, dans l'ordre du tri, et qui peut interrompre le parcours en retournant faux, sinon NULL pour seulement compter les groupes</param>
+/// <param name="contexteTraitement">Contexte transmis tel quel au traitement  chaque appel</param>
+/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+/// <param name="contexteProjection">Contexte transmis tel quel  la projection  chaque appel</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. Trier)</param>
+/// <returns>Nombre de groupes soumis au traitement, sinon -1 (modalit invalide ou chec du tri)</returns>
+long CTableau::Grouper(char modaliteComparaison, TraitementGroupe traitement, void* contexteTraitement, ProjectionEntite projection, const void* contexteProjection, char optionsTri)
+{
+	if (!Trier(modaliteComparaison, optionsTri)) return -1;
+	return GrouperAdresses(m_Tableau, m_Nombre, modaliteComparaison, traitement, contexteTraitement, projection, contexteProjection);
+}
+
+/// <summary>
+/// Permet de parcourir, par groupes d'entits gales selon la modalit de comparaison spcifie, un tableau d'adresses d'entits de ce tableau dj tri selon celle-ci (cf. CVueTableau::Grouper), sans modifier ce tableau ni ses entits
+/// </summary>
+/// <param name="entites">Adresse du tableau des adresses d'entits tries</param>
+/// <param name="nombre">Nombre d'adresses d'entits</param>
+/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'galit des entits d'un groupe</param>
+/// <param name="traitement">Fonction appele pour chaque groupe, sinon NULL pour seulement compter les groupes</param>
+/// <param name="contexteTraitement">Contexte transmis tel quel au traitement  chaque appel</param>
+/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+/// <param name="contexteProjection">Contexte transmis tel quel  la projection  chaque appel</param>
+/// <returns>Nombre de groupes soumis au traitement, sinon -1 (modalit invalide)</returns>
+long CTableau::GrouperAdresses(CEntite* const* entites, long nombre, char modaliteComparaison, TraitementGroupe traitement, void* contexteTraitement, ProjectionEntite projection, const void* contexteProjection) const
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return -1;
+	// Fonction de comparaison directe si le type d'entit en propose une, comme pour le tri
+	CEntite::ComparateurEntites comparateur = m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison);
+	return (comparateur != NULL)
+		? GrouperEntites(entites, nombre, CComparateurDirect(comparateur), traitement, contexteTraitement, projection, contexteProjection)
+		: GrouperEntites(entites, nombre, CComparateurVirtuel(modaliteComparaison), traitement, contexteTraitement, projection, contexteProjection);
+}
+
+/// <summary>
+/// Permet de trier de manire stable les entits selon une cl composite : les entits gales selon une modalit de comparaison sont dpartages par la suivante
+/// <para>Le tableau est ensuite considr comme tri selon la premire modalit (cf. TriActuel), ce qui prserve les recherches dichotomiques sur celle-ci</para>
+/// </summary>
+/// <param name="modalites">Adresse du tableau des modalits de comparaison successives</param>
+/// <param name="nombre">Nombre de modalits de comparaison</param>
+/// <param name="optionsTri">Combinaison d'options de tri (TriParallele), la stabilit tant toujours assure</param>
+/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+bool CTableau::TrierMulti(const char* modalites, int nombre, char optionsTri)
+{
+	if ((modalites == NULL) || (nombre < 1)) return false;
+	char nombreComparaisons = m_EntiteParDefaut->NombreComparaisons();
+	for (int indice = 0; indice < nombre; indice++)
+	{
+		if ((modalites[indice] < 0) || (modalites[indice] >= nombreComparaisons)) return false;
+	}
+	optionsTri |= CTableau::TriStable;
+	// Une cl rduite  une seule modalit revient  un tri stable ordinaire
+	if (nombre == 1) return Trier(modalites[0], optionsTri);
+	if (m_Nombre >= 2)
+	{
+		if (!Detacher()) return false;
+		CEntite::ComparateurEntites* comparateurs = (CEntite::ComparateurEntites*)malloc(nombre * sizeof(CEntite::ComparateurEntites));
+		if (comparateurs == NULL) return false;
+		for (int indice = 0; indice < nombre; indice++) comparateurs[indice] = m_EntiteParDefaut->ObtenirComparateur(modalites[indice]);
+		bool resultat = TrierEntites(m_Tableau, m_Nombre, 0, CComparateurMultiple(modalites, comparateurs, nombre), optionsTri, NombreFilsTri(m_Nombre, optionsTri));
+		free(comparateurs);
+		if (!resultat) return false;
+		ReconstruireIndexTri();
+	}
+	// Seule la premire modalit permet des recherches dichotomiques sur l'ensemble du tableau
+	m_TriActuel = modalites[0];
+	m_NombreTries = m_Nombre;
+	Publier();
+	return true;
+}
+
+/// <summary>
+/// Permet de placer en tte du tableau, tries selon la modalit de comparaison spcifie, ses plus petites entits selon celle-ci, l'ordre des suivantes tant indtermin (tri partiel, en O(n log k))
+/// <para>Le tableau est ensuite considr comme tri selon cette modalit sur ce prfixe seulement (cf. NombreTries) : un tri ultrieur selon la mme modalit ne trie alors que les entits suivantes, sans avoir  les fusionner avec le prfixe</para>
+/// </summary>
+/// <param name="nombre">Nombre d'entits  placer en tte<para>Un nombre au moins gal au nombre d'entits revient  un tri complet</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <returns>Vrai si le tri partiel est ralis, sinon faux</returns>
+bool CTableau::TrierPartiel(long nombre, char modaliteComparaison)
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons()) || (nombre < 0)) return false;
+	if (nombre >= m_Nombre) return Trier(modaliteComparaison);
+	if ((nombre == 0) || EstTrie(modaliteComparaison)) return true;
+	if (!Detacher()) return false;
+	CEntite::ComparateurEntites comparateur = m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison);
+	if (comparateur != NULL)
+	{
+		TrierPartiellement(m_Tableau, m_Nombre, nombre, CComparateurDirect(comparateur));
+	}
+	else
+	{
+		TrierPartiellement(m_Tableau, m_Nombre, nombre, CComparateurVirtuel(modaliteComparaison));
+	}
+	ReconstruireIndexTri();
+	// Seul le prfixe est tri, mais comme il regroupe les plus petites entits, il le reste aprs tout tri des suivantes
+	m_TriActuel = modaliteComparaison;
+	m_NombreTries = nombre;
+	Publier();
+	return true;
+}
+
+/// <summary>
+/// Permet de placer  l'indice spcifi l'entit qui s'y trouverait si le tableau tait tri selon la modalit de comparaison spcifie, les entits qui la prcdent ne lui tant pas suprieures et celles qui la suivent ne lui tant pas infrieures (slection, en O(n) en moyenne)
+/// <para>Sauf si le tableau tait dj tri selon cette modalit, il ne l'est plus ensuite</para>
+/// </summary>
+/// <param name="rang">Indice de l'entit  placer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <returns>Vrai si la slection est ralise, sinon faux</returns>
+bool CTableau::SelectionnerK(long rang, char modaliteComparaison)
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons()) || (rang < 0) || (rang >= m_Nombre)) return false;
+	if (EstTrie(modaliteComparaison)) return true;
+	if (!Detacher()) return false;
+	CEntite::ComparateurEntites comparateur = m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison);
+	if (comparateur != NULL)
+	{
+		SelectionnerElement(m_Tableau, m_Nombre, rang, CComparateurDirect(comparateur));
+	}
+	else
+	{
+		SelectionnerElement(m_Tableau, m_Nombre, rang, CComparateurVirtuel(modaliteComparaison));
+	}
+	ReconstruireIndexTri();
+	// La partition ne laisse aucun prfixe tri
+	m_TriActuel = CTableau::NonTrie;
+	m_NombreTries = 0;
+	Publier();
+	return true;
+}
+
+/// <summary>
+/// Permet d'obtenir l'union de ce tableau et d'un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion
+/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans un tableau et m fois dans l'autre l'est max(n, m) fois dans le rsultat, celles de ce tableau tant retenues en priorit</para>
+/// </summary>
+/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+bool CTableau::Union(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison) const
+{
+	return CombinerEnsembles(autreTableau, resultat, modaliteComparaison, true, true, true);
+}
+
+/// <summary>
+/// Permet d'obtenir l'intersection de ce tableau et d'un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion
+/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans un tableau et m fois dans l'autre l'est min(n, m) fois dans le rsultat, sous la forme de celles de ce tableau</para>
+/// </summary>
+/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+bool CTableau::Intersection(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison) const
+{
+	return CombinerEnsembles(autreTableau, resultat, modaliteComparaison, false, false, true);
+}
+
+/// <summary>
+/// Permet d'obtenir les entits de ce tableau absentes d'un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion
+/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans ce tableau et m fois dans l'autre l'est max(n - m, 0) fois dans le rsultat</para>
+/// </summary>
+/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+bool CTableau::Difference(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison) const
+{
+	return CombinerEnsembles(autreTableau, resultat, modaliteComparaison, true, false, false);
+}
+
+/// <summary>
+/// Permet d'obtenir les entits prsentes dans un seul des deux tableaux, ce tableau et un autre tant tris selon la mme modalit de comparaison, en un seul parcours de fusion
+/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans un tableau et m fois dans l'autre l'est |n - m| fois dans le rsultat</para>
+/// </summary>
+/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+bool CTableau::DifferenceSymetrique(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison) const
+{
+	return CombinerEnsembles(autreTableau, resultat, modaliteComparaison, true, true, false);
+}
+
+/// <summary>
+/// Permet de combiner ce tableau et un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion qui apparie une  une les entits gales (cf. Union, Intersection, Difference et DifferenceSymetrique)
+/// </summary>
+/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres</param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris</param>
+/// <param name="propres">Indique si les entits de ce tableau sans gale apparie dans l'autre sont retenues</param>
+/// <param name="autres">Indique si les entits de l'autre tableau sans gale apparie dans celui-ci sont retenues</param>
+/// <param name="communes">Indique si les entits de ce tableau apparies  une gale de l'autre sont retenues</param>
+/// <returns>Vrai si la combinaison est ralise, sinon faux</returns>
+bool CTableau::CombinerEnsembles(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison, bool propres, bool autres, bool communes) const
+{
+	// Vrifier la validit des paramtres (un tableau d'au plus une entit tant tri selon toute modalit)
+	if ((&resultat == this) || (&resultat == &autreTableau)) return false;
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+	if (((m_Nombre > 1) && !EstTrie(modaliteComparaison)) || ((autreTableau.m_Nombre > 1) && !autreTableau.EstTrie(modaliteComparaison))) return false;
+	const CEntite** retenues = (const CEntite**)malloc((m_Nombre + autreTableau.m_Nombre + 1) * sizeof(CEntite*));
+	if (retenues == NULL) return false;
+	// Fusion des deux suites tries, en ne relevant que les adresses des entits retenues
+	CEntite::ComparateurEntites comparateur = m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison);
+	long nombreRetenues = 0;
+	long indice = 0;
+	long autreIndice = 0;
+	while ((indice < m_Nombre) && (autreIndice < autreTableau.m_Nombre))
+	{
+		const CEntite* entite = m_Tableau[indice];
+		const CEntite* autreEntite = autreTableau.m_Tableau[autreIndice];
+		int resultatComparaison = (comparateur != NULL) ? comparateur(*entite, *autreEntite) : entite->Comparer(*autreEntite, modaliteComparaison);
+		if (resultatComparaison < 0)
+		{
+			if (propres) retenues[nombreRetenues++] = entite;
+			indice++;
+		}
+		else if (resultatComparaison > 0)
+		{
+			if (autres) retenues[nombreRetenues++] = autreEntite;
+			autreIndice++;
+		}
+		else
+		{
+			if (communes) retenues[nombreRetenues++] = entite;
+			indice++;
+			autreIndice++;
+		}
+	}
+	for (; propres && (indice < m_Nombre); indice++) retenues[nombreRetenues++] = m_Tableau[indice];
+	for (; autres && (autreIndice < autreTableau.m_Nombre); autreIndice++) retenues[nombreRetenues++] = autreTableau.m_Tableau[autreIndice];
+	// Seules les entits retenues sont clones, en une seule fois ; leur ordre est conserv par l'ajout, si bien que le rsultat est d'emble tri
+	resultat.Vider();
+	bool reussi;
+	if (resultat.PeutAjouterTrie(modaliteComparaison))
+	{
+		// Les entits retenues tant tries, et donc dj regroupes selon la seule modalit d'unicit ventuelle du rsultat, elles sont clones directement, en un seul parcours
+		bool unicite = resultat.m_EntiteParDefaut->EstComparaisonPourUnicite(modaliteComparaison);
+		reussi = resultat.Detacher(resultat.m_Nombre) && ((nombreRetenues <= resultat.m_Taille) || resultat.Redimensionner(nombreRetenues));
+		for (long rang = 0; reussi && (rang < nombreRetenues); rang++)
+		{
+			const CEntite* entite = retenues[rang];
+			if (!entite->EstValide(resultat.m_EntiteParDefaut)) continue;
+			if (unicite && (resultat.m_Nombre > 0))
+			{
+				const CEntite* precedente = resultat.m_Tableau[resultat.m_Nombre - 1];
+				if (((comparateur != NULL) ? comparateur(*precedente, *entite) : precedente->Comparer(*entite, modaliteComparaison)) == 0) continue;
+			}
+			CEntite* entiteClonee = resultat.ClonerEntite(*entite);
+			if (entiteClonee == NULL) reussi = false;
+			else resultat.m_Tableau[resultat.m_Nombre++] = entiteClonee;
+		}
+		// Les index sont reconstruits une seule fois, le tableau n'tant modifiable qu'en cas de russite complte
+		if (!reussi) resultat.Vider();
+		resultat.ReconstruireIndexHachage();
+		resultat.ReconstruireIndexTri();
+	}
+	else
+	{
+		reussi = (resultat.AjouterLot(retenues, nombreRetenues) >= 0);
+	}
+	free(retenues);
+	// Un tri maintenu selon une autre modalit a pu rordonner le rsultat
+	if (reussi && (resultat.TriActuel() == CTableau::NonTrie) && (modaliteComparaison < resultat.m_EntiteParDefaut->NombreComparaisons()))
+	{
+		resultat.m_TriActuel = modaliteComparaison;
+		resultat.m_NombreTries = resultat.m_Nombre;
+	}
+	resultat.Publier();
+	return reussi;
+}
+
+/// <summary>
+/// Indique si des entits tries selon la modalit de comparaison spcifie peuvent tre ajoutes en fin de ce tableau vide sans passer par AjouterLot (cf. CombinerEnsembles) : aucune autre modalit d'unicit, ni aucun tri maintenu selon une autre modalit
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les entits sont tries</param>
+/// <returns>Vrai si l'ajout direct prserve les rgles de ce tableau, sinon faux</returns>
+bool CTableau::PeutAjouterTrie(char modaliteComparaison) const
+{
+	char nombreComparaisons = m_EntiteParDefaut->NombreComparaisons();
+	if ((m_Nombre > 0) || (modaliteComparaison >= nombreComparaisons)) return false;
+	if (m_TriMaintenu && (m_TriActuel != CTableau::NonTrie) && (m_TriActuel != modaliteComparaison)) return false;
+	for (char autreModalite = 0; autreModalite < nombreComparaisons; autreModalite++)
+	{
+		if ((autreModalite != modaliteComparaison) && m_EntiteParDefaut->EstComparaisonPourUnicite(autreModalite)) return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Retourne le nombre de fils d'excution  utiliser pour trier le nombre spcifi d'entits de ce tableau selon les options de tri spcifies
+/// </summary>
+/// <param name="nombre">Nombre d'entits  trier</param>
+/// <param name="optionsTri">Combinaison d'options de tri</param>
+/// <returns>Nombre de fils d'excution (1 pour un tri en srie)</returns>
+long CTableau::NombreFilsTri(long nombre, char optionsTri) const
+{
+	// Un seul fil d'excution sans l'option de tri parallle, ou en de du seuil
+	if (((optionsTri & CTableau::TriParallele) == 0) || (nombre < m_SeuilTriParallele)) return 1;
+	long nombreFils = m_NombreFilsTri;
+	if (nombreFils == 0)
+	{
+		SYSTEM_INFO informationsSysteme;
+		GetSystemInfo(&informationsSysteme);
+		nombreFils = (long)informationsSysteme.dwNumberOfProcessors;
+	}
+	return (nombreFils > MAXIMUM_WAIT_OBJECTS) ? MAXIMUM_WAIT_OBJECTS : nombreFils;
+}
+
+/// <summary>
+/// Permet de configurer les tris parallles de ce tableau (cf. option TriParallele)
+/// </summary>
+/// <param name="nombreFils">Nombre de fils d'excution  utiliser<para>0 pour autant de fils que de processeurs, 1 pour toujours trier en srie</para></param>
+/// <param name="seuil">Nombre d'entits en de duquel le tri est ralis en srie</param>
+/// <returns>Vrai si la configuration est valide et a t retenue, sinon faux</returns>
+bool CTableau::ConfigurerTriParallele(long nombreFils, long seuil)
+{
+	if ((nombreFils < 0) || (seuil < 0)) return false;
+	m_NombreFilsTri = nombreFils;
+	m_SeuilTriParallele = seuil;
+	return true;
+}
 
-const void* bsearch_c(
-	const void* key,
-	const void* base,
-	size_t num,
-	size_t width,
-	int (*compare)(const void*, const void*, const void*),
-	const void* context
-)
+/// <summary>
+/// Permet de rechercher une entit dans le tableau en fonction de la modalit de comparaison spcifie
+/// </summary>
+/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors de la recherche de l'entit</param>
+/// <param name="indiceDebut">Indice de dbut de la recherche<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Indice de la premire occurrence d'entit correspondant  la recherche entame, sinon -1</returns>
+long CTableau::Rechercher(const CEntite& entiteARechercher, char modaliteComparaison, long indiceDebut) const
 {
-	char* lo = (char*)base;
-	char* hi = (char*)base + (num - 1) * width;
-	char* mid;
-	size_t half;
-	int result;
+	if (!entiteARechercher.EstValide(m_EntiteParDefaut)) return -1;
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return -1;
+	if ((indiceDebut < 0) || (indiceDebut >= m_Nombre)) return -1;
+	// Une recherche infructueuse dans l'index de hachage ventuel dispense de tout parcours du tableau
+	const CEntite* entiteEgale;
+	if ((m_IndexHachage != NULL) && (m_IndexHachage[modaliteComparaison] != NULL) && m_IndexHachage[modaliteComparaison]->Rechercher(entiteARechercher, entiteEgale) && (entiteEgale == NULL)) return -1;
+	// Un index de tri selon cette modalit permet une recherche dichotomique, quel que soit l'tat actuel de tri
+	if ((m_IndexTri != NULL) && (m_IndexTri[modaliteComparaison] != NULL)) return m_IndexTri[modaliteComparaison]->Rechercher(entiteARechercher, indiceDebut);
+	// Dans le prfixe tri selon cette modalit, la borne infrieure prise  partir de l'indice de dbut est la premire occurrence recherche ; seules les entits qui le suivent sont  parcourir
+	if ((modaliteComparaison == m_TriActuel) && (indiceDebut < m_NombreTries))
+	{
+		long indice = ChercherBorne(entiteARechercher, modaliteComparaison, false, indiceDebut, m_NombreTries);
+		if ((indice < m_NombreTries) && (entiteARechercher.Comparer(*(m_Tableau[indice]), modaliteComparaison) == 0)) return indice;
+		indiceDebut = m_NombreTries;
+		if (indiceDebut == m_Nombre) return -1;
+	}
+	const CEntite* adresseEntiteARechercher = &entiteARechercher;
+	const void* resultat = lfind_c(&adresseEntiteARechercher, m_Tableau + indiceDebut, m_Nombre - indiceDebut, sizeof(CEntite*), Comparer, &modaliteComparaison);
+	return (resultat != NULL) ? (long)((CEntite**)resultat - m_Tableau) : -1;
+}
 
-	while (lo <= hi)
-		if (half = num / 2)
+/// <summary>
+/// Permet de rechercher une entit dans le tableau  partir d'une simple cl (le contenu d'une chane, par exemple), sans construire d'entit modle, en fonction de la modalit de comparaison spcifie
+/// <para>Le type d'entit doit prendre en charge la comparaison  une cl (cf. CEntite::ComparerACle), et son hachage pour tirer parti d'un index de hachage (cf. CEntite::HacherCle) ; les index de tri et le prfixe tri sont exploits comme par la recherche d'une entit</para>
+/// </summary>
+/// <param name="cle">Cl  rechercher</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors de la recherche de l'entit</param>
+/// <param name="indiceDebut">Indice de dbut de la recherche<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Indice de la premire occurrence d'entit gale  la cl  partir de l'indice de dbut, sinon -1 (notamment si le type d'entit ne prend pas en charge les cls)</returns>
+long CTableau::Rechercher(const char* cle, char modaliteComparaison, long indiceDebut) const
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return -1;
+	if ((indiceDebut < 0) || (indiceDebut >= m_Nombre)) return -1;
+	int resultat;
+	if (!m_EntiteParDefaut->ComparerACle(cle, modaliteComparaison, resultat)) return -1;
+	// Une recherche infructueuse dans l'index de hachage ventuel dispense de tout parcours du tableau
+	const CEntite* entiteEgale;
+	if ((m_IndexHachage != NULL) && (m_IndexHachage[modaliteComparaison] != NULL) && m_IndexHachage[modaliteComparaison]->RechercherCle(cle, *m_EntiteParDefaut, entiteEgale) && (entiteEgale == NULL)) return -1;
+	// Un index de tri selon cette modalit permet une recherche dichotomique, quel que soit l'tat actuel de tri
+	if ((m_IndexTri != NULL) && (m_IndexTri[modaliteComparaison] != NULL)) return m_IndexTri[modaliteComparaison]->RechercherCle(cle, indiceDebut);
+	// Dans le prfixe tri selon cette modalit, la borne infrieure prise  partir de l'indice de dbut est la premire occurrence recherche
+	if ((modaliteComparaison == m_TriActuel) && (indiceDebut < m_NombreTries))
+	{
+		long indiceFin = m_NombreTries;
+		while (indiceDebut < indiceFin)
 		{
-			mid = lo + (num & 1 ? half : (half - 1)) * width;
-			if (!(result = (*compare)(key, mid, context)))
-				return(mid);
-			else if (result < 0)
+			long indiceMilieu = indiceDebut + (indiceFin - indiceDebut) / 2;
+			m_Tableau[indiceMilieu]->ComparerACle(cle, modaliteComparaison, resultat);
+			if (resultat < 0)
 			{
-				hi = mid - width;
-				num = num & 1 ? half : half - 1;
+				indiceDebut = indiceMilieu + 1;
 			}
-			else {
-				lo = mid + width;
-				num = half;
+			else
+			{
+				indiceFin = indiceMilieu;
 			}
 		}
-		else if (num)
-			return((*compare)(key, lo, context) ? NULL : lo);
-		else
-			break;
+		if ((indiceDebut < m_NombreTries) && m_Tableau[indiceDebut]->ComparerACle(cle, modaliteComparaison, resultat) && (resultat == 0)) return indiceDebut;
+		indiceDebut = m_NombreTries;
+	}
+	for (long indice = indiceDebut; indice < m_Nombre; indice++)
+	{
+		if (m_Tableau[indice]->ComparerACle(cle, modaliteComparaison, resultat) && (resultat == 0)) return indice;
+	}
+	return -1;
+}
 
-	return(NULL);
+/// <summary>
+/// Recherche dichotomique de la borne infrieure de l'entit spcifie, c'est--dire de l'indice de la premire entit qui ne lui est pas infrieure
+/// <para>Pour une entit absente, c'est l'indice auquel l'insrer pour prserver le tri ; pour une entit prsente, c'est l'indice de sa premire occurrence</para>
+/// </summary>
+/// <param name="entite">Modle de l'entit dont on cherche la borne</param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle le tableau doit tre actuellement tri</param>
+/// <returns>Indice compris entre 0 et le nombre d'entits, sinon -1 (entit invalide ou tableau non tri selon cette modalit)</returns>
+long CTableau::BorneInferieure(const CEntite& entite, char modaliteComparaison) const
+{
+	if (!EstTrie(modaliteComparaison)) return -1;
+	if (!entite.EstValide(m_EntiteParDefaut)) return -1;
+	return ChercherBorne(entite, modaliteComparaison, false, 0, m_Nombre);
+}
+
+/// <summary>
+/// Recherche dichotomique de la borne suprieure de l'entit spcifie, c'est--dire de l'indice de la premire entit qui lui est strictement suprieure
+/// </summary>
+/// <param name="entite">Modle de l'entit dont on cherche la borne</param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle le tableau doit tre actuellement tri</param>
+/// <returns>Indice compris entre 0 et le nombre d'entits, sinon -1 (entit invalide ou tableau non tri selon cette modalit)</returns>
+long CTableau::BorneSuperieure(const CEntite& entite, char modaliteComparaison) const
+{
+	if (!EstTrie(modaliteComparaison)) return -1;
+	if (!entite.EstValide(m_EntiteParDefaut)) return -1;
+	return ChercherBorne(entite, modaliteComparaison, true, 0, m_Nombre);
+}
+
+/// <summary>
+/// Recherche dichotomique de la plage des entits gales  l'entit spcifie
+/// <para>Une plage vide (indiceDebut == indiceFin) dsigne la position d'insertion de l'entit absente</para>
+/// </summary>
+/// <param name="entite">Modle de l'entit dont on cherche la plage</param>
+/// <param name="indiceDebut">[RESULTAT] Indice de la premire entit gale (cf. BorneInferieure)</param>
+/// <param name="indiceFin">[RESULTAT] Indice suivant celui de la dernire entit gale (cf. BorneSuperieure)</param>
+/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle le tableau doit tre actuellement tri</param>
+/// <returns>Vrai si la recherche a pu tre mene, sinon faux (entit invalide ou tableau non tri selon cette modalit)</returns>
+bool CTableau::PlageEgale(const CEntite& entite, long& indiceDebut, long& indiceFin, char modaliteComparaison) const
+{
+	indiceFin = -1;
+	indiceDebut = BorneInferieure(entite, modaliteComparaison);
+	if (indiceDebut < 0) return false;
+	// La borne suprieure ne peut se trouver qu'au-del de la borne infrieure
+	indiceFin = ChercherBorne(entite, modaliteComparaison, true, indiceDebut, m_Nombre);
+	return true;
+}
+
+/// <summary>
+/// Accesseur du nombre d'entits de ce tableau
+/// </summary>
+/// <returns>Nombre d'entits</returns>
+long CTableau::Nombre() const
+{
+	return m_Nombre;
+}
+
+/// <summary>
+/// Indexeur d'une entit en fonction de son indice dans ce tableau
+/// </summary>
+/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
+/// <returns>Rfrence de l'lment du tableau  l'indice valide, sinon l'entit par dfaut</returns>
+const CEntite& CTableau::Element(long indiceElement) const
+{
+	return *(((indiceElement >= 0) && (indiceElement < m_Nombre)) ? m_Tableau[indiceElement] : m_EntiteParDefaut);
+}
+
+/// <summary>
+/// Permet d'obtenir une entit de ce tableau afin de la modifier sur place, le partage de ses entits avec ses copies prenant d'abord fin (cf. constructeur par copie)
+/// <para>Le prfixe tri est ramen aux entits qui la prcdent ; la validit, les unicits et les index actifs ne sont en revanche pas mis  jour, si bien que la modification ne doit pas porter sur ce que comparent les modalits d'unicit ou indexes</para>
+/// </summary>
+/// <param name="indiceElement">Indice de l'lment  modifier<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Adresse de l'lment  modifier, sinon NULL (indice invalide, mode concurrent, o les lecteurs peuvent consulter l'entit, ou faute de mmoire)</returns>
+CEntite* CTableau::ElementModifiable(long indiceElement)
+{
+	if ((indiceElement < 0) || (indiceElement >= m_Nombre) || (m_Publication != NULL)) return NULL;
+	// Sans partage, seule la copie modifie change
+	if (!Detacher(indiceElement)) return NULL;
+	// L'entit modifie peut ne plus tre  sa place dans l'ordre de tri
+	if (m_NombreTries > indiceElement) m_NombreTries = indiceElement;
+	return m_Tableau[indiceElement];
+}
+
+/// <summary>
+/// Accesseur indiquant comment le tableau est actuellement tri
+/// </summary>
+/// <returns>Modalit de comparaison selon laquelle l'ensemble du tableau est tri, sinon NonTrie</returns>
+char CTableau::TriActuel() const
+{
+	return (m_NombreTries == m_Nombre) ? m_TriActuel : CTableau::NonTrie;
+}
+
+/// <summary>
+/// Accesseur de la longueur du prfixe du tableau qui est rest tri depuis le dernier tri (cf. Trier)
+/// </summary>
+/// <returns>Nombre d'entits du prfixe tri, gal au nombre d'entits si le tableau est entirement tri</returns>
+long CTableau::NombreTries() const
+{
+	return m_NombreTries;
+}
+
+/// <summary>
+/// Indique si le tableau est actuellement tri (selon la modalit spcifie)
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  tester comme modalit de tri actuel</param>
+/// <returns>Vrai si le tableau est actuellement tri selon la modalit de comparaison spcifie, sinon faux</returns>
+bool CTableau::EstTrie(char modaliteComparaison) const
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+	return (modaliteComparaison == m_TriActuel) && (m_NombreTries == m_Nombre);
+}
+
+/// <summary>
+/// Permet d'activer (ou de dsactiver) l'index de hachage maintenu par ce tableau pour la modalit de comparaison spcifie
+/// <para>Un tel index rend en temps constant (en moyenne) les tests d'unicit de Inserer, ainsi que les recherches infructueuses de Rechercher</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  indexer</param>
+/// <param name="activation">Indique si l'index doit tre activ ou dsactiv</param>
+/// <returns>Vrai si l'index est dans l'tat demand, sinon faux (notamment si l'entit par dfaut ne prend pas en charge le hachage selon cette modalit)</returns>
+bool CTableau::ActiverIndexHachage(char modaliteComparaison, bool activation)
+{
+	char nombreComparaisons = m_EntiteParDefaut->NombreComparaisons();
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= nombreComparaisons)) return false;
+	if (!activation)
+	{
+		if ((m_IndexHachage != NULL) && (m_IndexHachage[modaliteComparaison] != NULL))
+		{
+			delete m_IndexHachage[modaliteComparaison];
+			m_IndexHachage[modaliteComparaison] = NULL;
+		}
+		return true;
+	}
+	if (EstIndexeParHachage(modaliteComparaison)) return true;
+	unsigned long valeurHachage;
+	if (!m_EntiteParDefaut->Hacher(modaliteComparaison, valeurHachage)) return false;
+	// Allocation (au premier besoin) du tableau des index,  raison d'un emplacement par modalit de comparaison
+	if (m_IndexHachage == NULL)
+	{
+		m_IndexHachage = (CIndexHachage**)calloc(nombreComparaisons, sizeof(CIndexHachage*));
+		if (m_IndexHachage == NULL) return false;
+	}
+	// Construction de l'index  partir des entits actuellement prsentes
+	CIndexHachage* index = new CIndexHachage(modaliteComparaison);
+	if (index == NULL) return false;
+	for (long indice = 0; indice < m_Nombre; indice++)
+	{
+		if (!index->Ajouter(m_Tableau[indice]))
+		{
+			delete index;
+			return false;
+		}
+	}
+	m_IndexHachage[modaliteComparaison] = index;
+	return true;
+}
+
+/// <summary>
+/// Indique si ce tableau maintient actuellement un index de hachage pour la modalit de comparaison spcifie
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  tester</param>
+/// <returns>Vrai si un index de hachage est maintenu pour cette modalit de comparaison, sinon faux</returns>
+bool CTableau::EstIndexeParHachage(char modaliteComparaison) const
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+	return (m_IndexHachage != NULL) && (m_IndexHachage[modaliteComparaison] != NULL);
+}
+
+/// <summary>
+/// Permet de rfrencer l'entit qui vient d'tre insre  l'indice spcifi dans chaque index (de hachage ou de tri) actif
+/// <para>Tout index qui ne peut rfrencer cette entit est abandonn, afin de ne jamais laisser un index incomplet</para>
+/// </summary>
+/// <param name="indiceElement">Indice de l'entit  rfrencer</param>
+void CTableau::IndexerEntite(long indiceElement)
+{
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		if (m_IndexHachage != NULL)
+		{
+			CIndexHachage* index = m_IndexHachage[modaliteComparaison];
+			if ((index != NULL) && !index->Ajouter(m_Tableau[indiceElement]))
+			{
+				delete index;
+				m_IndexHachage[modaliteComparaison] = NULL;
+			}
+		}
+		if (m_IndexTri != NULL)
+		{
+			CIndexTri* index = m_IndexTri[modaliteComparaison];
+			if ((index != NULL) && !index->Inserer(indiceElement))
+			{
+				delete index;
+				m_IndexTri[modaliteComparaison] = NULL;
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Permet de retirer de chaque index (de hachage ou de tri) actif l'entit sur le point d'tre supprime  l'indice spcifi
+/// </summary>
+/// <param name="indiceElement">Indice de l'entit (encore prsente)  retirer</param>
+void CTableau::DesindexerEntite(long indiceElement)
+{
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		if ((m_IndexHachage != NULL) && (m_IndexHachage[modaliteComparaison] != NULL)) m_IndexHachage[modaliteComparaison]->Retirer(m_Tableau[indiceElement]);
+		if ((m_IndexTri != NULL) && (m_IndexTri[modaliteComparaison] != NULL)) m_IndexTri[modaliteComparaison]->Retirer(indiceElement);
+	}
+}
+
+/// <summary>
+/// Permet de supprimer tous les index de hachage de ce tableau
+/// </summary>
+void CTableau::SupprimerIndexHachage()
+{
+	if (m_IndexHachage == NULL) return;
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		if (m_IndexHachage[modaliteComparaison] != NULL) delete m_IndexHachage[modaliteComparaison];
+	}
+	free(m_IndexHachage);
+	m_IndexHachage = NULL;
+}
+
+/// <summary>
+/// Permet d'activer (ou de dsactiver) l'index de tri maintenu par ce tableau pour la modalit de comparaison spcifie
+/// <para>Un tel index rend dichotomiques les recherches de Rechercher selon cette modalit, sans imposer de tri au tableau lui-mme</para>
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  indexer</param>
+/// <param name="activation">Indique si l'index doit tre activ ou dsactiv</param>
+/// <returns>Vrai si l'index est dans l'tat demand, sinon faux</returns>
+bool CTableau::ActiverIndexTri(char modaliteComparaison, bool activation)
+{
+	char nombreComparaisons = m_EntiteParDefaut->NombreComparaisons();
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= nombreComparaisons)) return false;
+	if (!activation)
+	{
+		if ((m_IndexTri != NULL) && (m_IndexTri[modaliteComparaison] != NULL))
+		{
+			delete m_IndexTri[modaliteComparaison];
+			m_IndexTri[modaliteComparaison] = NULL;
+		}
+		return true;
+	}
+	if (EstIndexeParTri(modaliteComparaison)) return true;
+	// Allocation (au premier besoin) du tableau des index,  raison d'un emplacement par modalit de comparaison
+	if (m_IndexTri == NULL)
+	{
+		m_IndexTri = (CIndexTri**)calloc(nombreComparaisons, sizeof(CIndexTri*));
+		if (m_IndexTri == NULL) return false;
+	}
+	// Construction de l'index  partir des entits actuellement prsentes
+	CIndexTri* index = new CIndexTri(modaliteComparaison, &m_Tableau);
+	if (index == NULL) return false;
+	if (!index->Construire(m_Nombre))
+	{
+		delete index;
+		return false;
+	}
+	m_IndexTri[modaliteComparaison] = index;
+	return true;
+}
+
+/// <summary>
+/// Indique si ce tableau maintient actuellement un index de tri pour la modalit de comparaison spcifie
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  tester</param>
+/// <returns>Vrai si un index de tri est maintenu pour cette modalit de comparaison, sinon faux</returns>
+bool CTableau::EstIndexeParTri(char modaliteComparaison) const
+{
+	if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+	return (m_IndexTri != NULL) && (m_IndexTri[modaliteComparaison] != NULL);
+}
+
+/// <summary>
+/// Retourne l'indice de l'entit de rang spcifi selon l'index de tri de la modalit de comparaison spcifie
+/// <para>Permet de parcourir les entits dans l'ordre de cette modalit sans trier le tableau</para>
+/// </summary>
+/// <param name="rang">Rang de l'entit selon l'ordre de l'index<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <param name="modaliteComparaison">Modalit de comparaison de l'index de tri  utiliser</param>
+/// <returns>Indice de l'entit dans ce tableau, sinon -1 (notamment si cette modalit n'est pas indexe)</returns>
+long CTableau::IndiceTrie(long rang, char modaliteComparaison) const
+{
+	if (!EstIndexeParTri(modaliteComparaison)) return -1;
+	return m_IndexTri[modaliteComparaison]->Indice(rang);
+}
+
+/// <summary>
+/// Permet de reconstruire chaque index de tri actif, aprs une permutation des entits de ce tableau
+/// <para>Tout index qui ne peut tre reconstruit est abandonn</para>
+/// </summary>
+void CTableau::ReconstruireIndexTri()
+{
+	if (m_IndexTri == NULL) return;
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		CIndexTri* index = m_IndexTri[modaliteComparaison];
+		if ((index != NULL) && !index->Construire(m_Nombre))
+		{
+			delete index;
+			m_IndexTri[modaliteComparaison] = NULL;
+		}
+	}
+}
+
+/// <summary>
+/// Permet de reconstruire chaque index de hachage actif, aprs un remplacement des entits de ce tableau par des clones
+/// <para>Tout index qui ne peut tre reconstruit est abandonn</para>
+/// </summary>
+void CTableau::ReconstruireIndexHachage()
+{
+	if (m_IndexHachage == NULL) return;
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		CIndexHachage* index = m_IndexHachage[modaliteComparaison];
+		if (index == NULL) continue;
+		index->Vider();
+		for (long indice = 0; indice < m_Nombre; indice++)
+		{
+			if (!index->Ajouter(m_Tableau[indice]))
+			{
+				delete index;
+				m_IndexHachage[modaliteComparaison] = NULL;
+				break;
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Permet de supprimer tous les index de tri de ce tableau
+/// </summary>
+void CTableau::SupprimerIndexTri()
+{
+	if (m_IndexTri == NULL) return;
+	for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+	{
+		if (m_IndexTri[modaliteComparaison] != NULL) delete m_IndexTri[modaliteComparaison];
+	}
+	free(m_IndexTri);
+	m_IndexTri = NULL;
 }
 
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+/****************************************************************************
+*lfind.c - do a linear search
+*
+*       Copyright (c) 1985-1997, Microsoft Corporation. All rights reserved.
+*
+*Purpose:
+*       defines _lfind() - do a linear search of an array.
+*
+*******************************************************************************/
+
 /***
 *char *lfind(key, base, num, width, compare, context) - do a linear search
 *
@@ -485,308 +3233,588 @@ const void* lfind_c(
 			return((void*)base);
 		else
 		{
-			base = (char*)base + width;
-			place++;
+			base = (char*)base + width;
+			place++;
+		}
+	return(NULL);
+}
+
+/// <summary>
+/// Permet d'activer ou de dsactiver l'allocation dans une arne propre  ce tableau (cf. CArene) des entits qu'il clone, ce qui rduit le cot des allocations et la fragmentation de la mmoire pour de nombreuses petites entits, Vider rendant alors la mmoire en une seule fois
+/// <para>La dsactivation n'est possible que si le tableau est vide, et aucune des deux en mode concurrent ; les entits adoptes ou ne prenant pas en charge ClonerDans restent alloues individuellement</para>
+/// </summary>
+/// <param name="activation">Indique si l'arne doit tre active ou dsactive</param>
+/// <returns>Vrai si l'arne est dans l'tat demand, sinon faux</returns>
+bool CTableau::ActiverArene(bool activation)
+{
+	// En mode concurrent, les entits retires doivent rester o elles sont jusqu' leur rcupration
+	if ((m_Publication != NULL) && (activation != (m_Arene != NULL))) return false;
+	if (!activation)
+	{
+		if (m_Arene == NULL) return true;
+		if (m_Nombre > 0) return false;
+		delete m_Arene;
+		m_Arene = NULL;
+		return true;
+	}
+	if (m_Arene == NULL)
+	{
+		// Une arne propre  ce tableau ne peut tre cre que s'il ne partage plus ses entits
+		if (!Detacher()) return false;
+		m_Arene = new CArene();
+	}
+	return (m_Arene != NULL);
+}
+
+/// <summary>
+/// Accesseur de l'arne de ce tableau, afin notamment d'en consulter les statistiques
+/// </summary>
+/// <returns>Adresse de l'arne, sinon NULL si elle n'est pas active</returns>
+const CArene* CTableau::Arene() const
+{
+	return m_Arene;
+}
+
+/// <summary>
+/// Indique si les entits de ce tableau sont actuellement partages avec au moins une de ses copies (cf. constructeur par copie)
+/// </summary>
+/// <returns>Vrai si les entits sont partages, sinon faux</returns>
+bool CTableau::EstPartage() const
+{
+	return (m_CompteurPartage != NULL) && (*m_CompteurPartage > 1);
+}
+
+/// <summary>
+/// Permet, en mode concurrent, de publier l'tat actuel de ce tableau  l'intention de ses lecteurs, puis de dtruire les entits retires qu'ils ne peuvent plus consulter
+/// <para>Doit conclure toute modification du tableau des pointeurs, de l'tat de tri ou des entits</para>
+/// </summary>
+void CTableau::Publier()
+{
+	if ((m_Publication == NULL) || !m_Publication->Publier(m_Tableau, m_Nombre, m_TriActuel, m_NombreTries)) return;
+	CEntite* entite;
+	while ((entite = m_Publication->ExtraireRecuperable()) != NULL) DetruireEntite(entite, true);
+}
+
+/// <summary>
+/// Permet d'activer ou de dsactiver le mode concurrent, dans lequel des lecteurs (cf. CLecteurTableau) peuvent consulter ce tableau, sans verrou, pendant que le fil d'excution qui le modifie (le seul  pouvoir appeler ses mthodes) poursuit ses modifications
+/// <para>Chaque modification publie un nouvel tat du tableau : les ajouts en fin de tableau restent en temps constant amorti, toute autre modification des pointeurs (insertion, suppression, tri) portant sur une copie du tableau des pointeurs ; les entits supprimes ne sont dtruites qu'une fois qu'aucun lecteur ne peut plus les consulter</para>
+/// <para>La dsactivation (comme la destruction du tableau) suppose qu'aucun lecteur ne le consulte plus ; l'arne ne peut tre ni active, ni dsactive dans ce mode, et les copies du tableau n'en partagent pas les entits</para>
+/// </summary>
+/// <param name="activation">Indique si le mode concurrent doit tre activ ou dsactiv</param>
+/// <returns>Vrai si le tableau est dans le mode demand, sinon faux</returns>
+bool CTableau::ActiverConcurrence(bool activation)
+{
+	if (activation == (m_Publication != NULL)) return true;
+	if (activation)
+	{
+		// Les lecteurs ne doivent consulter que des entits propres  ce tableau, et un tableau des pointeurs allou, que les modifications ne touchent pas sur place
+		if (!Detacher()) return false;
+		if (m_Tableau == m_TableauInterne)
+		{
+			CEntite** tableau = (CEntite**)malloc(m_Taille * sizeof(CEntite*));
+			if (tableau == NULL) return false;
+			memcpy(tableau, m_Tableau, m_Nombre * sizeof(CEntite*));
+			m_Tableau = tableau;
 		}
-	return(NULL);
+		m_Publication = new CPublicationTableau();
+		if (!m_Publication->Publier(m_Tableau, m_Nombre, m_TriActuel, m_NombreTries))
+		{
+			delete m_Publication;
+			m_Publication = NULL;
+			return false;
+		}
+		return true;
+	}
+	// Plus aucun lecteur ne consultant ce tableau, tout ce qui a t retir est rcupr, ainsi que le tableau des pointeurs publi s'il a t remplac depuis
+	CEntite* entite;
+	while ((entite = m_Publication->ExtraireRecuperable(true)) != NULL) DetruireEntite(entite, true);
+	CEntite* const* tableauPublie = m_Publication->Instantane()->m_Tableau;
+	if ((tableauPublie != NULL) && (tableauPublie != m_Tableau)) free((void*)tableauPublie);
+	delete m_Publication;
+	m_Publication = NULL;
+	return true;
 }
 
-/***
-*qsort.c - quicksort algorithm; qsort() library function for sorting arrays
-*
-*       Copyright (c) 1985-1997, Microsoft Corporation. All rights reserved.
-*
-*Purpose:
-*       To implement the qsort() routine for sorting arrays.
-*
-*******************************************************************************/
-
-
-/* prototypes for local routines */
-static void shortsort_c(char* lo, char* hi, size_t width,
-	int (*comp)(const void*, const void*, const void*),
-	const void* context);
-static void swap_c(char* p, char* q, size_t width);
-
-/* this parameter defines the cutoff between using quick sort and
-   insertion sort for arrays; arrays with lengths shorter or equal to the
-   below value use insertion sort */
-
-#define QSORT_CUTOFF 8            /* testing shows that this is good value */
-
-
-   /***
-   *qsort(base, num, wid, comp, context) - quicksort function for sorting arrays
-   *
-   *Purpose:
-   *       quicksort the array of elements
-   *       side effects:  sorts in place
-   *
-   *Entry:
-   *       char *base = pointer to base of array
-   *       unsigned num  = number of elements in the array
-   *       unsigned width = width in bytes of each array element
-   *       int (*comp)() = pointer to function returning analog of strcmp for
-   *               strings, but supplied by user for comparing the array elements.
-   *               it accepts 2 pointers to elements and returns neg if 1<2, 0 if
-   *               1=2, pos if 1>2.
-   *
-   *Exit:
-   *       returns void
-   *
-   *Exceptions:
-   *
-   *******************************************************************************/
-
-   /* sort the array between lo and hi (inclusive) */
-
-void qsort_c(
-	void* base,
-	size_t num,
-	size_t width,
-	int (*compare)(const void*, const void*, const void*),
-	const void* context
-)
+/// <summary>
+/// Indique si ce tableau est en mode concurrent (cf. ActiverConcurrence)
+/// </summary>
+/// <returns>Vrai si le mode concurrent est activ, sinon faux</returns>
+bool CTableau::EstConcurrent() const
 {
-	char* lo, * hi;              /* ends of sub-array currently sorting */
-	char* mid;                  /* points to middle of subarray */
-	char* loguy, * higuy;        /* traveling pointers for partition step */
-	size_t size;              /* size of the sub-array */
-	char* lostk[30], * histk[30];
-	int stkptr;                 /* stack for saving sub-array to be processed */
+	return (m_Publication != NULL);
+}
 
-	/* Note: the number of stack entries required is no more than
-	   1 + log2(size), so 30 is sufficient for any array */
+/// <summary>
+/// Accesseur de la publication des tats de ce tableau  l'intention de ses lecteurs (cf. CLecteurTableau)
+/// </summary>
+/// <returns>Adresse de la publication, sinon NULL si le mode concurrent n'est pas activ</returns>
+CPublicationTableau* CTableau::Publication() const
+{
+	return m_Publication;
+}
 
-	if (num < 2 || width == 0)
-		return;                 /* nothing to do */
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-	stkptr = 0;                 /* initialize stack */
+/// <summary>
+/// Constructeur spcifique : rserve un emplacement de lecteur du tableau spcifi
+/// </summary>
+/// <param name="tableau">Tableau en mode concurrent  consulter, qui doit le rester tant que ce lecteur existe</param>
+CLecteurTableau::CLecteurTableau(const CTableau& tableau)
+	:m_Publication(tableau.Publication()), m_Emplacement(-1), m_Instantane(NULL), m_EntiteParDefaut(&tableau.Element(-1))
+{
+	if (m_Publication != NULL) m_Emplacement = m_Publication->ReserverEmplacement();
+}
 
-	lo = (char*)base;
-	hi = (char*)base + width * (num - 1);        /* initialize limits */
+/// <summary>
+/// Destructeur : termine une ventuelle lecture en cours, et rend l'emplacement de lecteur
+/// </summary>
+CLecteurTableau::~CLecteurTableau()
+{
+	if (m_Emplacement >= 0) m_Publication->RendreEmplacement(m_Emplacement);
+}
 
-	/* this entry point is for pseudo-recursion calling: setting
-	   lo and hi and jumping to here is like recursion, but stkptr is
-	   prserved, locals aren't, so we preserve stuff on the stack */
-recurse:
+/// <summary>
+/// Indique si ce lecteur a pu rserver un emplacement de lecteur (le tableau tant en mode concurrent, et le nombre maximal de lecteurs n'tant pas atteint)
+/// </summary>
+/// <returns>Vrai si ce lecteur peut commencer des lectures, sinon faux</returns>
+bool CLecteurTableau::EstValide() const
+{
+	return (m_Emplacement >= 0);
+}
 
-	size = (hi - lo) / width + 1;        /* number of el's to sort */
+/// <summary>
+/// Permet de commencer une lecture, sur l'tat actuellement publi du tableau
+/// </summary>
+/// <returns>Vrai si la lecture est commence, sinon faux (lecteur invalide)</returns>
+bool CLecteurTableau::CommencerLecture()
+{
+	if (m_Emplacement < 0) return false;
+	m_Instantane = m_Publication->CommencerLecture(m_Emplacement);
+	return true;
+}
 
-	/* below a certain size, it is faster to use a O(n^2) sorting method */
-	if (size <= QSORT_CUTOFF) {
-		shortsort_c(lo, hi, width, compare, context);
-	}
-	else {
-		/* First we pick a partititioning element.  The efficiency of the
-		   algorithm demands that we find one that is approximately the
-		   median of the values, but also that we select one fast.  Using
-		   the first one produces bad performace if the array is already
-		   sorted, so we use the middle one, which would require a very
-		   wierdly arranged array for worst case performance.  Testing shows
-		   that a median-of-three algorithm does not, in general, increase
-		   performance. */
+/// <summary>
+/// Permet de terminer la lecture en cours, les entits consultes ne devant plus l'tre ensuite
+/// </summary>
+void CLecteurTableau::TerminerLecture()
+{
+	if (m_Instantane == NULL) return;
+	m_Instantane = NULL;
+	m_Publication->TerminerLecture(m_Emplacement);
+}
 
-		mid = lo + (size / 2) * width;      /* find middle element */
-		swap_c(mid, lo, width);               /* swap it to beginning of array */
+/// <summary>
+/// Accesseur du nombre d'entits de l'tat consult
+/// </summary>
+/// <returns>Nombre d'entits, sinon 0 hors lecture</returns>
+long CLecteurTableau::Nombre() const
+{
+	return (m_Instantane != NULL) ? m_Instantane->m_Nombre : 0;
+}
 
-		/* We now wish to partition the array into three pieces, one
-		   consisiting of elements <= partition element, one of elements
-		   equal to the parition element, and one of element >= to it.  This
-		   is done below; comments indicate conditions established at every
-		   step. */
+/// <summary>
+/// Accesseur de l'entit spcifie de l'tat consult
+/// </summary>
+/// <param name="indiceElement">Indice de l'entit<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Entit  cet indice valide, sinon l'entit par dfaut du tableau (y compris hors lecture)</returns>
+const CEntite& CLecteurTableau::Element(long indiceElement) const
+{
+	// Comme CTableau::Element, un indice invalide dsigne l'entit par dfaut, que le tableau retourne pour l'indice -1
+	if ((m_Instantane == NULL) || (indiceElement < 0) || (indiceElement >= m_Instantane->m_Nombre)) return *m_EntiteParDefaut;
+	return *(m_Instantane->m_Tableau[indiceElement]);
+}
 
-		loguy = lo;
-		higuy = hi + width;
+/// <summary>
+/// Accesseur de la modalit de comparaison selon laquelle l'tat consult est entirement tri
+/// </summary>
+/// <returns>Modalit de comparaison, sinon CTableau::NonTrie</returns>
+char CLecteurTableau::TriActuel() const
+{
+	if ((m_Instantane == NULL) || (m_Instantane->m_NombreTries != m_Instantane->m_Nombre)) return CTableau::NonTrie;
+	return m_Instantane->m_TriActuel;
+}
 
-		/* Note that higuy decreases and loguy increases on every iteration,
-		   so loop must terminate. */
-		for (;;) {
-			/* lo <= loguy < hi, lo < higuy <= hi + 1,
-			   A[i] <= A[lo] for lo <= i <= loguy,
-			   A[i] >= A[lo] for higuy <= i <= hi */
+/// <summary>
+/// Permet de rechercher dans l'tat consult une entit gale  celle spcifie, selon la modalit de comparaison spcifie : par dichotomie sur le prfixe tri selon cette modalit, puis par parcours des entits suivantes
+/// </summary>
+/// <param name="entiteARechercher">Entit  rechercher</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <returns>Indice de la premire entit gale, sinon -1</returns>
+long CLecteurTableau::Rechercher(const CEntite& entiteARechercher, char modaliteComparaison) const
+{
+	if (m_Instantane == NULL) return -1;
+	CEntite* const* tableau = m_Instantane->m_Tableau;
+	long nombre = m_Instantane->m_Nombre;
+	long indiceDebut = 0;
+	if ((modaliteComparaison == m_Instantane->m_TriActuel) && (m_Instantane->m_NombreTries > 0))
+	{
+		// Recherche de la borne infrieure, comme CTableau::Rechercher, afin de retourner la premire entit gale et non celle sur laquelle tombe la dichotomie
+		long nombreTries = m_Instantane->m_NombreTries;
+		long indiceFin = nombreTries;
+		while (indiceDebut < indiceFin)
+		{
+			long indiceMilieu = indiceDebut + (indiceFin - indiceDebut) / 2;
+			if (entiteARechercher.Comparer(*(tableau[indiceMilieu]), modaliteComparaison) > 0)
+			{
+				indiceDebut = indiceMilieu + 1;
+			}
+			else
+			{
+				indiceFin = indiceMilieu;
+			}
+		}
+		if ((indiceDebut < nombreTries) && (tableau[indiceDebut]->Comparer(entiteARechercher, modaliteComparaison) == 0)) return indiceDebut;
+		indiceDebut = nombreTries;
+	}
+	for (long indice = indiceDebut; indice < nombre; indice++)
+	{
+		if (tableau[indice]->Comparer(entiteARechercher, modaliteComparaison) == 0) return indice;
+	}
+	return -1;
+}
 
-			do {
-				loguy += width;
-			} while (loguy <= hi && compare(loguy, lo, context) <= 0);
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-			/* lo < loguy <= hi+1, A[i] <= A[lo] for lo <= i < loguy,
-			   either loguy > hi or A[loguy] > A[lo] */
+/// <summary>
+/// Constructeur spcifique
+/// </summary>
+/// <param name="entiteParDefaut">Entit par dfaut des tableaux  construire, servant  valider les entits produites</param>
+/// <param name="nombreProducteurs">Nombre de producteurs<para>Au moins gal  1</para></param>
+CConstructeurTableau::CConstructeurTableau(const CEntite& entiteParDefaut, long nombreProducteurs)
+	:m_EntiteParDefaut(entiteParDefaut.Cloner()), m_NombreProducteurs(0), m_Tampons(NULL)
+{
+	if (nombreProducteurs < 1) nombreProducteurs = 1;
+	// Les tampons sont aligns sur une ligne de cache, faute de quoi chacun pourrait chevaucher deux lignes partages avec ses voisins
+	m_Tampons = (CTamponProducteur*)_aligned_malloc(nombreProducteurs * sizeof(CTamponProducteur), CConstructeurTableau::TailleLigneCache);
+	if (m_Tampons == NULL) return;
+	memset(m_Tampons, 0, nombreProducteurs * sizeof(CTamponProducteur));
+	m_NombreProducteurs = nombreProducteurs;
+}
 
-			do {
-				higuy -= width;
-			} while (higuy > lo && compare(higuy, lo, context) >= 0);
+/// <summary>
+/// Destructeur : dtruit les entits produites qui n'ont pas t ajoutes  un tableau
+/// </summary>
+CConstructeurTableau::~CConstructeurTableau()
+{
+	Vider();
+	if (m_Tampons != NULL) _aligned_free(m_Tampons);
+	delete m_EntiteParDefaut;
+}
 
-			/* lo-1 <= higuy <= hi, A[i] >= A[lo] for higuy < i <= hi,
-			   either higuy <= lo or A[higuy] < A[lo] */
+/// <summary>
+/// Accesseur du nombre de producteurs
+/// </summary>
+/// <returns>Nombre de producteurs, sinon 0 (faute de mmoire  la construction)</returns>
+long CConstructeurTableau::NombreProducteurs() const
+{
+	return m_NombreProducteurs;
+}
 
-			if (higuy < loguy)
-				break;
+/// <summary>
+/// Permet au producteur spcifi d'ajouter  son tampon une nouvelle entit,  partir du modle spcifi d'entit
+/// <para>Chaque producteur ne doit alimenter que son propre tampon, et un seul fil d'excution  la fois peut le faire</para>
+/// </summary>
+/// <param name="producteur">Numro du producteur<para>Compris entre 0 et le nombre de producteurs - 1</para></param>
+/// <param name="entiteAAjouter">Modle de l'entit  ajouter</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux (producteur ou entit invalide, ou faute de mmoire)</returns>
+bool CConstructeurTableau::Ajouter(long producteur, const CEntite& entiteAAjouter)
+{
+	if ((producteur < 0) || (producteur >= m_NombreProducteurs) || !entiteAAjouter.EstValide(m_EntiteParDefaut)) return false;
+	return PlacerEntite(producteur, entiteAAjouter.Cloner());
+}
 
-			/* if loguy > hi or higuy <= lo, then we would have exited, so
-			   A[loguy] > A[lo], A[higuy] < A[lo],
-			   loguy < hi, highy > lo */
+/// <summary>
+/// Permet au producteur spcifi d'ajouter  son tampon une nouvelle entit,  partir de l'entit temporaire spcifie, dont les ressources sont transfres (cf. ClonerParDeplacement)
+/// </summary>
+/// <param name="producteur">Numro du producteur<para>Compris entre 0 et le nombre de producteurs - 1</para></param>
+/// <param name="entiteAAjouter">Entit temporaire  ajouter</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CConstructeurTableau::Ajouter(long producteur, CEntite&& entiteAAjouter)
+{
+	if ((producteur < 0) || (producteur >= m_NombreProducteurs) || !entiteAAjouter.EstValide(m_EntiteParDefaut)) return false;
+	return PlacerEntite(producteur, entiteAAjouter.ClonerParDeplacement());
+}
 
-			swap_c(loguy, higuy, width);
+/// <summary>
+/// Permet au producteur spcifi d'ajouter  son tampon l'entit spcifie, cre dynamiquement, sans la cloner : le constructeur en devient propritaire
+/// <para>En cas d'chec, l'entit est dtruite</para>
+/// </summary>
+/// <param name="producteur">Numro du producteur<para>Compris entre 0 et le nombre de producteurs - 1</para></param>
+/// <param name="entiteAAdopter">Adresse de l'entit cre dynamiquement</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CConstructeurTableau::Adopter(long producteur, CEntite* entiteAAdopter)
+{
+	if (entiteAAdopter == NULL) return false;
+	if ((producteur < 0) || (producteur >= m_NombreProducteurs))
+	{
+		delete entiteAAdopter;
+		return false;
+	}
+	return PlacerEntite(producteur, entiteAAdopter);
+}
 
-			/* A[loguy] < A[lo], A[higuy] > A[lo]; so condition at top
-			   of loop is re-established */
-		}
+/// <summary>
+/// Accesseur du nombre d'entits produites par le producteur spcifi, en attente d'ajout
+/// </summary>
+/// <param name="producteur">Numro du producteur</param>
+/// <returns>Nombre d'entits, sinon -1 (producteur invalide)</returns>
+long CConstructeurTableau::Nombre(long producteur) const
+{
+	if ((producteur < 0) || (producteur >= m_NombreProducteurs)) return -1;
+	return m_Tampons[producteur].m_Nombre;
+}
 
-		/*     A[i] >= A[lo] for higuy < i <= hi,
-			   A[i] <= A[lo] for lo <= i < loguy,
-			   higuy < loguy, lo <= higuy <= hi
-		   implying:
-			   A[i] >= A[lo] for loguy <= i <= hi,
-			   A[i] <= A[lo] for lo <= i <= higuy,
-			   A[i] = A[lo] for higuy < i < loguy */
+/// <summary>
+/// Permet d'ajouter en fin du tableau spcifi, en une seule fois, les entits produites, par numro de producteur puis dans l'ordre de production, les tampons tant ensuite vids
+/// <para>Doit tre appele une fois tous les producteurs arrts ; les entits rejetes (doublons selon les modalits d'unicit du tableau) sont dtruites</para>
+/// </summary>
+/// <param name="tableau">Tableau  alimenter, dont l'entit par dfaut est du mme type que celle de ce constructeur</param>
+/// <param name="rejetees">[RESULTAT] Adresse d'un tableau d'autant d'indicateurs que d'entits produites, dont chacun indique si l'entit correspondante, dans l'ordre d'ajout, a t rejete, sinon NULL</param>
+/// <returns>Nombre d'entits ajoutes, sinon -1 (faute de mmoire, les tampons tant alors conservs)</returns>
+long CConstructeurTableau::Construire(CTableau& tableau, bool* rejetees)
+{
+	long nombre = 0;
+	for (long producteur = 0; producteur < m_NombreProducteurs; producteur++) nombre += m_Tampons[producteur].m_Nombre;
+	if (nombre == 0) return 0;
+	// Concatnation des tampons dans l'ordre des producteurs, puis adoption en un seul lot
+	CEntite** entites = (CEntite**)malloc(nombre * sizeof(CEntite*));
+	if (entites == NULL) return -1;
+	long indice = 0;
+	for (long producteur = 0; producteur < m_NombreProducteurs; producteur++)
+	{
+		CTamponProducteur& tampon = m_Tampons[producteur];
+		if (tampon.m_Nombre > 0) memcpy(entites + indice, tampon.m_Entites, tampon.m_Nombre * sizeof(CEntite*));
+		indice += tampon.m_Nombre;
+	}
+	long resultat = tableau.AdopterLot(entites, nombre, rejetees);
+	free(entites);
+	if (resultat < 0) return -1;
+	// Les entits appartiennent dsormais au tableau (ou ont t dtruites), seuls les tampons sont rendus
+	for (long producteur = 0; producteur < m_NombreProducteurs; producteur++)
+	{
+		CTamponProducteur& tampon = m_Tampons[producteur];
+		if (tampon.m_Entites != NULL) free(tampon.m_Entites);
+		tampon.m_Entites = NULL;
+		tampon.m_Nombre = 0;
+		tampon.m_Taille = 0;
+	}
+	return resultat;
+}
 
-		swap_c(lo, higuy, width);     /* put partition element in place */
+/// <summary>
+/// Permet de dtruire toutes les entits produites en attente d'ajout
+/// </summary>
+void CConstructeurTableau::Vider()
+{
+	for (long producteur = 0; producteur < m_NombreProducteurs; producteur++)
+	{
+		CTamponProducteur& tampon = m_Tampons[producteur];
+		for (long indice = 0; indice < tampon.m_Nombre; indice++) delete tampon.m_Entites[indice];
+		if (tampon.m_Entites != NULL) free(tampon.m_Entites);
+		tampon.m_Entites = NULL;
+		tampon.m_Nombre = 0;
+		tampon.m_Taille = 0;
+	}
+}
 
-		/* OK, now we have the following:
-			  A[i] >= A[higuy] for loguy <= i <= hi,
-			  A[i] <= A[higuy] for lo <= i < higuy
-			  A[i] = A[lo] for higuy <= i < loguy    */
+/// <summary>
+/// Permet de placer dans le tampon du producteur spcifi l'entit spcifie, dont le constructeur devient propritaire, aprs l'avoir valide
+/// <para>En cas d'chec, l'entit est dtruite</para>
+/// </summary>
+/// <param name="producteur">Numro du producteur</param>
+/// <param name="entite">Adresse de l'entit cre dynamiquement, sinon NULL (chec)</param>
+/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+bool CConstructeurTableau::PlacerEntite(long producteur, CEntite* entite)
+{
+	if (entite == NULL) return false;
+	CTamponProducteur& tampon = m_Tampons[producteur];
+	if (!entite->EstValide(m_EntiteParDefaut))
+	{
+		delete entite;
+		return false;
+	}
+	// Croissance gomtrique du tampon, comme celle du tableau des pointeurs d'un tableau
+	if (tampon.m_Nombre == tampon.m_Taille)
+	{
+		long nouvelleTaille = (tampon.m_Taille < CTableau::TailleMinimale) ? CTableau::TailleMinimale : (tampon.m_Taille * 2);
+		void* nouvelleAdresse = realloc(tampon.m_Entites, nouvelleTaille * sizeof(CEntite*));
+		if (nouvelleAdresse == NULL)
+		{
+			delete entite;
+			return false;
+		}
+		tampon.m_Entites = (CEntite**)nouvelleAdresse;
+		tampon.m_Taille = nouvelleTaille;
+	}
+	tampon.m_Entites[tampon.m_Nombre++] = entite;
+	return true;
+}
 
-			  /* We've finished the partition, now we want to sort the subarrays
-				 [lo, higuy-1] and [loguy, hi].
-				 We do the smaller one first to minimize stack usage.
-				 We only sort arrays of length 2 or more.*/
+//---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-		if (higuy - 1 - lo >= hi - loguy) {
-			if (lo + width < higuy) {
-				lostk[stkptr] = lo;
-				histk[stkptr] = higuy - width;
-				++stkptr;
-			}                           /* save big recursion for later */
+/// <summary>
+/// Constructeur spcifique : vue vide sur le tableau spcifi
+/// </summary>
+/// <param name="tableau">Tableau sur lequel porte la vue</param>
+CVueTableau::CVueTableau(const CTableau& tableau)
+	:m_Tableau(&tableau), m_Entites(NULL), m_Nombre(0), m_Taille(0), m_TriActuel(CTableau::NonTrie)
+{
+}
 
-			if (loguy < hi) {
-				lo = loguy;
-				goto recurse;           /* do small recursion */
-			}
-		}
-		else {
-			if (loguy < hi) {
-				lostk[stkptr] = loguy;
-				histk[stkptr] = hi;
-				++stkptr;               /* save big recursion for later */
-			}
+/// <summary>
+/// Destructeur
+/// </summary>
+CVueTableau::~CVueTableau()
+{
+	Vider();
+}
 
-			if (lo + width < higuy) {
-				hi = higuy - width;
-				goto recurse;           /* do small recursion */
+/// <summary>
+/// Permet de (re)construire la vue  partir des entits du tableau qui vrifient le prdicat spcifi, dans l'ordre du tableau
+/// <para>La vue reprend l'tat de tri du tableau s'il est entirement tri ; la mmoire dj alloue par la vue est rutilise</para>
+/// </summary>
+/// <param name="predicat">Fonction dcidant si une entit est retenue, sinon NULL pour retenir toutes les entits</param>
+/// <param name="contexte">Contexte transmis au prdicat, sinon NULL</param>
+/// <returns>Vrai si la vue a pu tre construite, sinon faux (faute de mmoire, la vue tant alors vide)</returns>
+bool CVueTableau::Filtrer(CTableau::PredicatEntite predicat, const void* contexte)
+{
+	m_Nombre = 0;
+	m_TriActuel = CTableau::NonTrie;
+	long nombre = m_Tableau->Nombre();
+	// Sans prdicat, toutes les entits sont retenues : la taille ncessaire est connue d'avance
+	if ((predicat == NULL) && (nombre > m_Taille))
+	{
+		void* nouvelleAdresse = realloc(m_Entites, nombre * sizeof(CEntite*));
+		if (nouvelleAdresse == NULL) return false;
+		m_Entites = (CEntite**)nouvelleAdresse;
+		m_Taille = nombre;
+	}
+	for (long indice = 0; indice < nombre; indice++)
+	{
+		const CEntite& entite = m_Tableau->Element(indice);
+		if ((predicat != NULL) && !predicat(entite, contexte)) continue;
+		// Croissance gomtrique, comme celle du tableau des pointeurs d'un tableau
+		if (m_Nombre == m_Taille)
+		{
+			long nouvelleTaille = (m_Taille < CTableau::TailleMinimale) ? CTableau::TailleMinimale : (m_Taille * 2);
+			void* nouvelleAdresse = realloc(m_Entites, nouvelleTaille * sizeof(CEntite*));
+			if (nouvelleAdresse == NULL)
+			{
+				m_Nombre = 0;
+				return false;
 			}
+			m_Entites = (CEntite**)nouvelleAdresse;
+			m_Taille = nouvelleTaille;
 		}
+		// La vue ne modifie jamais les entits : l'adresse n'est non constante que pour les fonctions de tri
+		m_Entites[m_Nombre++] = const_cast<CEntite*>(&entite);
 	}
+	// Une slection dans l'ordre d'un tableau entirement tri reste trie
+	char triTableau = m_Tableau->TriActuel();
+	if ((triTableau != CTableau::NonTrie) && m_Tableau->EstTrie(triTableau)) m_TriActuel = triTableau;
+	return true;
+}
 
-	/* We have sorted the array, except for any pending sorts on the stack.
-	   Check if there are any, and do them. */
-
-	--stkptr;
-	if (stkptr >= 0) {
-		lo = lostk[stkptr];
-		hi = histk[stkptr];
-		goto recurse;           /* pop subarray from stack */
-	}
-	else
-		return;                 /* all subarrays done */
+/// <summary>
+/// Permet de trier les entits de la vue selon la modalit de comparaison spcifie, sans modifier le tableau (cf. CTableau::TrierAdresses)
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::Trier)</param>
+/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+bool CVueTableau::Trier(char modaliteComparaison, char optionsTri)
+{
+	if (modaliteComparaison == m_TriActuel) return true;
+	if (!m_Tableau->TrierAdresses(m_Entites, m_Nombre, 0, modaliteComparaison, optionsTri)) return false;
+	m_TriActuel = modaliteComparaison;
+	return true;
 }
 
+/// <summary>
+/// Permet de parcourir la vue par groupes d'entits gales selon la modalit de comparaison spcifie, aprs un tri de la vue selon celle-ci, sans modifier le tableau (cf. CTableau::Grouper)
+/// </summary>
+/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'galit des entits d'un groupe</param>
+/// <param name="traitement">Fonction appele pour chaque groupe, dans l'ordre du tri, sinon NULL pour seulement compter les groupes</param>
+/// <param name="contexteTraitement">Contexte transmis tel quel au traitement  chaque appel</param>
+/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+/// <param name="contexteProjection">Contexte transmis tel quel  la projection  chaque appel</param>
+/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::Trier)</param>
+/// <returns>Nombre de groupes soumis au traitement, sinon -1 (modalit invalide ou chec du tri)</returns>
+long CVueTableau::Grouper(char modaliteComparaison, CTableau::TraitementGroupe traitement, void* contexteTraitement, CTableau::ProjectionEntite projection, const void* contexteProjection, char optionsTri)
+{
+	if (!Trier(modaliteComparaison, optionsTri)) return -1;
+	return m_Tableau->GrouperAdresses(m_Entites, m_Nombre, modaliteComparaison, traitement, contexteTraitement, projection, contexteProjection);
+}
 
-/***
-*shortsort_c(hi, lo, width, comp) - insertion sort for sorting short arrays
-*
-*Purpose:
-*       sorts the sub-array of elements between lo and hi (inclusive)
-*       side effects:  sorts in place
-*       assumes that lo < hi
-*
-*Entry:
-*       char *lo = pointer to low element to sort
-*       char *hi = pointer to high element to sort
-*       unsigned width = width in bytes of each array element
-*       int (*comp)() = pointer to function returning analog of strcmp for
-*               strings, but supplied by user for comparing the array elements.
-*               it accepts 2 pointers to elements and returns neg if 1<2, 0 if
-*               1=2, pos if 1>2.
-*
-*Exit:
-*       returns void
-*
-*Exceptions:
-*
-*******************************************************************************/
+/// <summary>
+/// Accesseur du nombre d'entits de la vue
+/// </summary>
+/// <returns>Nombre d'entits retenues</returns>
+long CVueTableau::Nombre() const
+{
+	return m_Nombre;
+}
 
-static void shortsort_c(
-	char* lo,
-	char* hi,
-	size_t width,
-	int (*comp)(const void*, const void*, const void*),
-	const void* context
-)
+/// <summary>
+/// Accesseur de l'entit spcifie de la vue
+/// </summary>
+/// <param name="indiceElement">Indice de l'entit dans la vue<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+/// <returns>Entit  cet indice</returns>
+const CEntite& CVueTableau::Element(long indiceElement) const
 {
-	char* p, * max;
+	return *(m_Entites[indiceElement]);
+}
 
-	/* Note: in assertions below, i and j are alway inside original bound of
-	   array to sort. */
+/// <summary>
+/// Accesseur de la modalit de comparaison selon laquelle la vue est trie
+/// </summary>
+/// <returns>Modalit de comparaison, sinon CTableau::NonTrie</returns>
+char CVueTableau::TriActuel() const
+{
+	return m_TriActuel;
+}
 
-	while (hi > lo) {
-		/* A[i] <= A[j] for i <= j, j > hi */
-		max = lo;
-		for (p = lo + width; p <= hi; p += width) {
-			/* A[i] <= A[max] for lo <= i < p */
-			if (comp(p, max, context) > 0) {
-				max = p;
+/// <summary>
+/// Permet de rechercher dans la vue une entit gale  celle spcifie, selon la modalit de comparaison spcifie : par dichotomie si la vue est trie selon cette modalit, sinon par parcours
+/// </summary>
+/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+/// <returns>Indice dans la vue de la premire occurrence d'entit gale, sinon -1</returns>
+long CVueTableau::Rechercher(const CEntite& entiteARechercher, char modaliteComparaison) const
+{
+	if (modaliteComparaison == m_TriActuel)
+	{
+		// Recherche de la borne infrieure, qui est la premire occurrence si elle existe
+		long indiceDebut = 0;
+		long indiceFin = m_Nombre;
+		while (indiceDebut < indiceFin)
+		{
+			long indiceMilieu = indiceDebut + (indiceFin - indiceDebut) / 2;
+			if (entiteARechercher.Comparer(*(m_Entites[indiceMilieu]), modaliteComparaison) > 0)
+			{
+				indiceDebut = indiceMilieu + 1;
+			}
+			else
+			{
+				indiceFin = indiceMilieu;
 			}
-			/* A[i] <= A[max] for lo <= i <= p */
 		}
-
-		/* A[i] <= A[max] for lo <= i <= hi */
-
-		swap_c(max, hi, width);
-
-		/* A[i] <= A[hi] for i <= hi, so A[i] <= A[j] for i <= j, j >= hi */
-
-		hi -= width;
-
-		/* A[i] <= A[j] for i <= j, j > hi, loop top condition established */
+		return ((indiceDebut < m_Nombre) && (m_Entites[indiceDebut]->Comparer(entiteARechercher, modaliteComparaison) == 0)) ? indiceDebut : -1;
+	}
+	for (long indice = 0; indice < m_Nombre; indice++)
+	{
+		if (m_Entites[indice]->Comparer(entiteARechercher, modaliteComparaison) == 0) return indice;
 	}
-	/* A[i] <= A[j] for i <= j, j > lo, which implies A[i] <= A[j] for i < j,
-	   so array is sorted */
+	return -1;
 }
 
-
-/***
-*swap_c(a, b, width) - swap two elements
-*
-*Purpose:
-*       swaps the two array elements of size width
-*
-*Entry:
-*       char *a, *b = pointer to two elements to swap
-*       unsigned width = width in bytes of each array element
-*
-*Exit:
-*       returns void
-*
-*Exceptions:
-*
-*******************************************************************************/
-
-static void swap_c(
-	char* a,
-	char* b,
-	size_t width
-)
+/// <summary>
+/// Permet de vider la vue, en rendant la mmoire qu'elle occupe
+/// </summary>
+void CVueTableau::Vider()
 {
-	char tmp;
-
-	if (a != b)
-		/* Do the swap one character at a time to avoid potential alignment
-		   problems. */
-		while (width--) {
-			tmp = *a;
-			*a++ = *b;
-			*b++ = tmp;
-		}
+	if (m_Entites != NULL) free(m_Entites);
+	m_Entites = NULL;
+	m_Nombre = 0;
+	m_Taille = 0;
+	m_TriActuel = CTableau::NonTrie;
 }
@@ -6,6 +6,12 @@
 /// </summary>
 class CEntite
 {
+public:
+	/// <summary>
+	/// Dfinit un type de donnes pour les fonctions capables de comparer directement deux entits, selon une modalit de comparaison fixe
+	/// </summary>
+	typedef int(*ComparateurEntites)(const CEntite& entite, const CEntite& autreEntite);
+
 public:
 	/// <summary>
 	/// Constructeur par dfaut
@@ -42,6 +48,27 @@ public:
 	/// <returns>Objet cr dynamiquement par clonage</returns>
 	virtual CEntite* Cloner() const;
 
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit en lui transfrant ses ressources (dplacement), cette entit restant ensuite valide mais dans un tat indtermin
+	/// <para>Par dfaut, il s'agit d'un simple clonage ; toute classe drive d'une classe qui rcrit cette mthode doit elle aussi la rcrire</para>
+	/// </summary>
+	/// <returns>Objet cr dynamiquement par dplacement</returns>
+	virtual CEntite* ClonerParDeplacement();
+
+	/// <summary>
+	/// Retourne la taille en octets d'un objet de ce type d'entit (cf. ClonerDans)
+	/// </summary>
+	/// <returns>Taille de l'objet</returns>
+	virtual long TailleObjet() const;
+
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit  l'adresse spcifie, qui dispose d'au moins TailleObjet octets (construction "en place")
+	/// <para>Par dfaut, ce n'est pas pris en charge ; toute classe drive d'une classe qui rcrit cette mthode et TailleObjet doit elle aussi les rcrire</para>
+	/// </summary>
+	/// <param name="adresse">Adresse de l'emplacement o construire le duplicata</param>
+	/// <returns>Objet cr par clonage  cette adresse, sinon NULL si ce type d'entit ne le prend pas en charge</returns>
+	virtual CEntite* ClonerDans(void* adresse) const;
+
 	/// <summary>
 	/// Indique si les donnes de cette entit sont valides
 	/// </summary>
@@ -64,157 +91,1786 @@ public:
 	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
 	/// <returns>-1 si cette entit est "infrieure"  l'autre entit, 1 si cette entit est "suprieure"  l'autre entit, sinon 0 (en cas d'galit)</returns>
 	virtual int Comparer(const CEntite& autreEntite, char modaliteComparaison) const;
+
+	/// <summary>
+	/// Calcule une valeur de hachage de cette entit, compatible avec la modalit de comparaison spcifie
+	/// <para>Deux entits gales selon cette modalit (Comparer retournant 0) doivent imprativement produire la mme valeur de hachage</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+	/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+	/// <returns>Vrai si ce type d'entit prend en charge le hachage selon cette modalit de comparaison, sinon faux</returns>
+	virtual bool Hacher(char modaliteComparaison, unsigned long& valeurHachage) const;
+
+	/// <summary>
+	/// Retourne une fonction de comparaison directe, quivalente  Comparer pour la modalit de comparaison spcifie, dont les tris peuvent tirer parti
+	/// <para>Cette fonction doit convenir  toute entit que celle pour laquelle cette mthode est appele considre comme valide (cf. TesterValidite)</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <returns>Fonction de comparaison directe, sinon NULL (les comparaisons passent alors par Comparer)</returns>
+	virtual ComparateurEntites ObtenirComparateur(char modaliteComparaison) const;
+
+	/// <summary>
+	/// Permet d'crire la cl de tri de cette entit selon la modalit de comparaison spcifie : une suite d'octets dont la comparaison lexicographique (octets non signs, une cl tant plus petite que celles qu'elle prfixe) ordonne les entits exactement comme Comparer
+	/// <para>Un tri avec l'option CTableau::TriParCles calcule ainsi une fois pour toutes la cl de chaque entit, au lieu de renormaliser les deux entits  chaque comparaison</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  respecter</param>
+	/// <param name="tampon">Adresse du tampon recevant la cl</param>
+	/// <param name="taille">Taille du tampon en octets<para>Si elle est insuffisante, rien n'est garanti quant au contenu du tampon</para></param>
+	/// <returns>Longueur de la cl en octets (ventuellement suprieure  la taille du tampon, qui doit alors tre agrandi), sinon -1 si ce type d'entit ne prend pas en charge de cl de tri selon cette modalit</returns>
+	virtual long RepresentationOctets(char modaliteComparaison, unsigned char* tampon, long taille) const;
+
+	/// <summary>
+	/// Compare cette entit  la cl spcifie (cf. CTableau::Rechercher), selon la modalit de comparaison spcifie, sans avoir  construire d'entit modle
+	/// </summary>
+	/// <param name="cle">Cl  laquelle on compare cette entit, sous la forme propre  ce type d'entit (le contenu d'une chane, par exemple)</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <param name="resultat">[RESULTAT] -1 si cette entit est "infrieure"  la cl, 1 si elle lui est "suprieure", sinon 0 (en cas d'galit)</param>
+	/// <returns>Vrai si ce type d'entit prend en charge la comparaison  une cl selon cette modalit, sinon faux</returns>
+	virtual bool ComparerACle(const char* cle, char modaliteComparaison, int& resultat) const;
+
+	/// <summary>
+	/// Calcule une valeur de hachage de la cl spcifie, identique  celle (cf. Hacher) de toute entit de ce type gale  cette cl selon la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="cle">Cl  hacher, sous la forme propre  ce type d'entit</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit doit tre respecte par le hachage</param>
+	/// <param name="valeurHachage">[RESULTAT] Valeur de hachage calcule, sinon 0</param>
+	/// <returns>Vrai si ce type d'entit prend en charge le hachage d'une cl selon cette modalit, sinon faux</returns>
+	virtual bool HacherCle(const char* cle, char modaliteComparaison, unsigned long& valeurHachage) const;
 };
 
 /// <summary>
-/// Dfinit un tableau d'entits
+/// Dfinit un index de hachage d'entits, selon une modalit de comparaison donne
+/// <para>L'index ne possde pas les entits rfrences : il ne retient que leurs adresses</para>
 /// </summary>
-class CTableau : public CEntite
+class CIndexHachage
 {
 public:
 	/// <summary>
-	/// Modalit de comparaison non utilisable, permettant de signaler que le tableau n'est actuellement pas tri
+	/// Constructeur spcifique
 	/// </summary>
-	static const char NonTrie = -1;
+	/// <param name="modaliteComparaison">Modalit de comparaison dont l'galit sert de critre de recherche dans cet index</param>
+	CIndexHachage(char modaliteComparaison);
+
+	/// <summary>
+	/// Destructeur
+	/// </summary>
+	~CIndexHachage();
+
+	/// <summary>
+	/// Accesseur de la modalit de comparaison de cet index
+	/// </summary>
+	/// <returns>Modalit de comparaison</returns>
+	char ModaliteComparaison() const;
+
+	/// <summary>
+	/// Accesseur du nombre d'entits rfrences par cet index
+	/// </summary>
+	/// <returns>Nombre d'entits</returns>
+	long Nombre() const;
+
+	/// <summary>
+	/// Permet de retirer toutes les entits de cet index
+	/// </summary>
+	void Vider();
+
+	/// <summary>
+	/// Permet de rfrencer l'entit spcifie dans cet index
+	/// </summary>
+	/// <param name="entite">Adresse de l'entit  rfrencer</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Ajouter(const CEntite* entite);
+
+	/// <summary>
+	/// Permet de retirer de cet index l'entit spcifie par son adresse
+	/// </summary>
+	/// <param name="entite">Adresse de l'entit  retirer</param>
+	/// <returns>Vrai si l'entit tait rfrence et a t retire, sinon faux</returns>
+	bool Retirer(const CEntite* entite);
+
+	/// <summary>
+	/// Permet de rechercher une entit gale (selon la modalit de comparaison de cet index)  celle spcifie
+	/// </summary>
+	/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+	/// <param name="entiteTrouvee">[RESULTAT] Adresse d'une entit gale trouve, sinon NULL</param>
+	/// <returns>Vrai si la recherche a pu tre mene (hachage possible de l'entit  rechercher), sinon faux</returns>
+	bool Rechercher(const CEntite& entiteARechercher, const CEntite*& entiteTrouvee) const;
+
+	/// <summary>
+	/// Permet de rechercher une entit gale (selon la modalit de comparaison de cet index)  la cl spcifie, sans construire d'entit modle (cf. CEntite::ComparerACle)
+	/// </summary>
+	/// <param name="cle">Cl  rechercher</param>
+	/// <param name="modele">Entit du type des entits indexes, servant  hacher la cl (cf. CEntite::HacherCle)</param>
+	/// <param name="entiteTrouvee">[RESULTAT] Adresse d'une entit gale trouve, sinon NULL</param>
+	/// <returns>Vrai si la recherche a pu tre mene (hachage possible de la cl), sinon faux</returns>
+	bool RechercherCle(const char* cle, const CEntite& modele, const CEntite*& entiteTrouvee) const;
+
+private:
+	/// <summary>
+	/// Permet de redistribuer toutes les entits rfrences dans une table de la taille spcifie
+	/// </summary>
+	/// <param name="nouvelleTaille">Nouvelle taille de la table (puissance de 2)</param>
+	/// <returns>Vrai si la redistribution a pu se faire, sinon faux</returns>
+	bool Redimensionner(long nouvelleTaille);
+
+	/// <summary>
+	/// Retourne l'emplacement de dpart du sondage dans la table pour la valeur de hachage spcifie
+	/// </summary>
+	/// <param name="valeurHachage">Valeur de hachage</param>
+	/// <returns>Indice de l'emplacement de dpart</returns>
+	long EmplacementInitial(unsigned long valeurHachage) const;
+
+private:
+	/// <summary>
+	/// Marqueur d'un emplacement libr par un retrait, et qui ne doit pas interrompre un sondage
+	/// </summary>
+	static const CEntite* const EmplacementLibere;
+
+private:
+	/// <summary>
+	/// Membre contenant le nombre d'entits rfrences
+	/// </summary>
+	long m_Nombre;
+
+	/// <summary>
+	/// Membre contenant le nombre d'emplacements non vides (entits rfrences et emplacements librs)
+	/// </summary>
+	long m_NombreOccupes;
+
+	/// <summary>
+	/// Membre contenant la taille actuelle de la table (0 ou une puissance de 2)
+	/// </summary>
+	long m_Taille;
+
+	/// <summary>
+	/// Membre contenant l'adresse de dbut de la table des adresses d'entits
+	/// </summary>
+	const CEntite** m_Entites;
+
+	/// <summary>
+	/// Membre contenant l'adresse de dbut de la table des valeurs de hachage de chaque entit rfrence
+	/// </summary>
+	unsigned long* m_Hachages;
+
+	/// <summary>
+	/// Membre contenant la modalit de comparaison de cet index
+	/// </summary>
+	char m_ModaliteComparaison;
+};
 
+/// <summary>
+/// Dfinit un index de tri d'entits, selon une modalit de comparaison donne
+/// <para>L'index ne possde pas les entits : il ne retient que leurs indices dans le tableau des pointeurs qu'il rfrence, tris selon sa modalit (les entits gales l'tant par indice croissant)</para>
+/// </summary>
+class CIndexTri
+{
 public:
 	/// <summary>
 	/// Constructeur spcifique
 	/// </summary>
-	/// <param name="entiteParDefaut">Modle d'entit par dfaut (c'est ce qui dtermine le "dnominateur commun"  tout lment que l'on veut placer dans ce tableau)</param>
-	CTableau(const CEntite& entiteParDefaut);
+	/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'ordre de cet index</param>
+	/// <param name="adresseTableau">Adresse du membre contenant l'adresse du tableau des pointeurs vers les entits indexes</param>
+	CIndexTri(char modaliteComparaison, CEntite** const* adresseTableau);
 
 	/// <summary>
-	/// Constructeur par copie
+	/// Destructeur
 	/// </summary>
-	/// <param name="source">Entit source de cette copie</param>
-	CTableau(const CTableau& source);
+	~CIndexTri();
 
 	/// <summary>
-	/// Destructeur
+	/// Accesseur de la modalit de comparaison de cet index
 	/// </summary>
-	~CTableau();
+	/// <returns>Modalit de comparaison</returns>
+	char ModaliteComparaison() const;
 
 	/// <summary>
-	/// Permet de crer un duplicata de cette entit
+	/// Accesseur du nombre d'entits rfrences par cet index
 	/// </summary>
-	/// <returns>Objet cr dynamiquement par clonage</returns>
-	CEntite* Cloner() const;
+	/// <returns>Nombre d'entits</returns>
+	long Nombre() const;
 
 	/// <summary>
-	/// Permet de supprimer toutes les entits du tableau
+	/// Retourne l'indice, dans le tableau des pointeurs, de l'entit de rang spcifi selon l'ordre de cet index
+	/// </summary>
+	/// <param name="rang">Rang de l'entit selon l'ordre de cet index<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Indice de l'entit, sinon -1</returns>
+	long Indice(long rang) const;
+
+	/// <summary>
+	/// Permet de retirer toutes les entits de cet index
 	/// </summary>
 	void Vider();
 
 	/// <summary>
-	/// Permet d'ajouter une nouvelle entit en fin de tableau,  partir du modle spcifi d'entit
+	/// Permet de reconstruire entirement cet index  partir des entits du tableau des pointeurs
 	/// </summary>
-	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+	/// <param name="nombre">Nombre d'entits du tableau des pointeurs</param>
+	/// <returns>Vrai si la construction a pu se faire, sinon faux</returns>
+	bool Construire(long nombre);
+
+	/// <summary>
+	/// Permet de rfrencer l'entit qui vient d'tre insre  l'indice spcifi du tableau des pointeurs
+	/// <para>Les indices suprieurs ou gaux dj rfrencs sont dcals d'une position</para>
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion de l'entit dans le tableau des pointeurs</param>
 	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
-	bool Ajouter(const CEntite& entiteAAjouter);
+	bool Inserer(long indiceInsertion);
 
 	/// <summary>
-	/// Permet d'insrer une nouvelle entit  la position spcifie du tableau,  partir du modle spcifi d'entit
+	/// Permet de retirer de cet index l'entit sur le point d'tre supprime  l'indice spcifi du tableau des pointeurs
+	/// <para>Les indices suprieurs dj rfrencs sont dcals d'une position</para>
 	/// </summary>
-	/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
-	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
-	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
-	bool Inserer(long indiceInsertion, const CEntite& entiteAAjouter);
+	/// <param name="indiceElement">Indice de l'entit (encore prsente) dans le tableau des pointeurs</param>
+	void Retirer(long indiceElement);
 
 	/// <summary>
-	/// Permet de supprimer l'entit spcifie du tableau
+	/// Permet de rechercher, par dichotomie, la premire entit gale (selon la modalit de comparaison de cet index)  celle spcifie
 	/// </summary>
-	/// <param name="indiceElement">Indice de l'lment  supprimer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
-	/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
-	bool Supprimer(long indiceElement);
+	/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+	/// <param name="indiceDebut">Indice minimal de l'entit recherche</param>
+	/// <returns>Plus petit indice, suprieur ou gal  l'indice de dbut, d'une entit gale, sinon -1</returns>
+	long Rechercher(const CEntite& entiteARechercher, long indiceDebut) const;
 
 	/// <summary>
-	/// Permet de trier les entits selon la modalit de comparaison spcifie
+	/// Permet de rechercher, par dichotomie, la premire entit gale (selon la modalit de comparaison de cet index)  la cl spcifie, sans construire d'entit modle (cf. CEntite::ComparerACle)
 	/// </summary>
-	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors du tri des entits</param>
-	/// <returns>Vrai si le tri est ralis, sinon faux</returns>
-	bool Trier(char modaliteComparaison = (char)0);
+	/// <param name="cle">Cl  rechercher</param>
+	/// <param name="indiceDebut">Indice minimal de l'entit recherche</param>
+	/// <returns>Plus petit indice, suprieur ou gal  l'indice de dbut, d'une entit gale, sinon -1</returns>
+	long RechercherCle(const char* cle, long indiceDebut) const;
 
 	/// <summary>
-	/// Permet de rechercher une entit dans le tableau en fonction de la modalit de comparaison spcifie
+	/// Compare deux indices selon l'ordre de cet index (ce qui fait de l'index son propre comparateur lors de sa construction par tri)
 	/// </summary>
-	/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
-	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors de la recherche de l'entit</param>
-	/// <param name="indiceDebut">Indice de dbut de la recherche<para>Compris entre 0 et le nombre d'entits - 1</para></param>
-	/// <returns>Indice de la premire occurrence d'entit correspondant  la recherche entame, sinon -1</returns>
-	long Rechercher(const CEntite& entiteARechercher, char modaliteComparaison = (char)0, long indiceDebut = 0) const;
+	/// <param name="indice">Indice d'une entit</param>
+	/// <param name="autreIndice">Indice d'une autre entit</param>
+	/// <returns>-1 si l'entit du premier indice est "infrieure"  l'autre (ou, en cas d'galit, si son indice est infrieur), 1 dans le cas contraire, sinon 0</returns>
+	int operator()(long indice, long autreIndice) const;
 
+private:
 	/// <summary>
-	/// Accesseur du nombre d'entits de ce tableau
+	/// Recherche dichotomique du premier rang dont le couple (entit, indice) n'est pas infrieur au couple spcifi
 	/// </summary>
-	/// <returns>Nombre d'entits</returns>
-	long Nombre() const;
+	/// <param name="entite">Entit du couple de rfrence</param>
+	/// <param name="indice">Indice du couple de rfrence</param>
+	/// <returns>Rang compris entre 0 et le nombre d'entits</returns>
+	long ChercherRang(const CEntite& entite, long indice) const;
 
+private:
 	/// <summary>
-	/// Indexeur d'une entit en fonction de son indice dans ce tableau
+	/// Membre contenant le nombre d'entits rfrences
 	/// </summary>
-	/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
-	/// <returns>Rfrence de l'lment du tableau  l'indice valide, sinon l'entit par dfaut</returns>
-	const CEntite& Element(long indiceElement) const;
+	long m_Nombre;
 
 	/// <summary>
-	/// Indexeur d'une entit en fonction de son indice dans ce tableau
+	/// Membre contenant la taille actuelle du tableau des indices
 	/// </summary>
-	/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
-	/// <returns>Rfrence de l'lment du tableau  l'indice valide, sinon l'entit par dfaut</returns>
-	template <class T> T& Element(long indiceElement) const
-	{
-		return (T&)Element(indiceElement);
-	}
+	long m_Taille;
 
 	/// <summary>
-	/// Accesseur indiquant comment le tableau est actuellement tri
+	/// Membre contenant l'adresse de dbut du tableau des indices, tris selon la modalit de comparaison de cet index
 	/// </summary>
-	/// <returns>Nombre d'entits</returns>
-	char TriActuel() const;
+	long* m_Indices;
 
 	/// <summary>
-	/// Indique si le tableau est actuellement tri (selon la modalit spcifie)
+	/// Membre contenant l'adresse du membre contenant l'adresse du tableau des pointeurs (ce qui rend cet index insensible aux rallocations de ce dernier)
 	/// </summary>
-	/// <param name="modaliteComparaison">Modalit de comparaison  tester comme modalit de tri actuel</param>
-	/// <returns>Vrai si le tableau est actuellement tri selon la modalit de comparaison spcifie, sinon faux</returns>
-	bool EstTrie(char modaliteComparaison = (char)0) const;
+	CEntite** const* m_AdresseTableau;
+
+	/// <summary>
+	/// Membre contenant la modalit de comparaison de cet index
+	/// </summary>
+	char m_ModaliteComparaison;
+};
+
+/// <summary>
+/// Dfinit une arne d'allocation de petits objets, par classes de tailles : chaque bloc allou n'est dcoup qu'en emplacements d'une mme classe
+/// <para>Les emplacements librs sont recycls pour leur classe ; les blocs ne sont rendus qu'en une seule fois, par Vider</para>
+/// </summary>
+class CArene
+{
+public:
+	/// <summary>
+	/// Taille en octets de chaque bloc allou
+	/// </summary>
+	static const long TailleBloc = 65536;
+
+	/// <summary>
+	/// cart en octets entre deux classes de tailles successives (ainsi que l'alignement de tout emplacement)
+	/// </summary>
+	static const long Granularite = 8;
+
+	/// <summary>
+	/// Taille maximale en octets d'un emplacement
+	/// </summary>
+	static const long TailleMaximale = 256;
+
+public:
+	/// <summary>
+	/// Constructeur par dfaut
+	/// </summary>
+	CArene();
+
+	/// <summary>
+	/// Destructeur
+	/// </summary>
+	~CArene();
+
+	/// <summary>
+	/// Permet d'allouer un emplacement de la taille spcifie
+	/// </summary>
+	/// <param name="taille">Taille en octets de l'emplacement<para>Comprise entre 1 et TailleMaximale</para></param>
+	/// <returns>Adresse de l'emplacement, sinon NULL</returns>
+	void* Allouer(long taille);
+
+	/// <summary>
+	/// Permet de librer l'emplacement spcifi, qui devient rutilisable pour sa classe de tailles
+	/// </summary>
+	/// <param name="adresse">Adresse de l'emplacement, obtenue par Allouer</param>
+	/// <param name="taille">Taille en octets demande lors de l'allocation de cet emplacement</param>
+	void Liberer(void* adresse, long taille);
+
+	/// <summary>
+	/// Indique si l'adresse spcifie se trouve dans l'un des blocs de cette arne
+	/// </summary>
+	/// <param name="adresse">Adresse  tester</param>
+	/// <returns>Vrai si l'adresse appartient  cette arne, sinon faux</returns>
+	bool Contient(const void* adresse) const;
+
+	/// <summary>
+	/// Permet de rendre en une seule fois tous les blocs de cette arne, ce qui invalide tous les emplacements allous
+	/// </summary>
+	void Vider();
+
+	/// <summary>
+	/// Accesseur du nombre de blocs allous
+	/// </summary>
+	/// <returns>Nombre de blocs</returns>
+	long NombreBlocs() const;
+
+	/// <summary>
+	/// Accesseur du nombre d'octets rservs par les blocs allous
+	/// </summary>
+	/// <returns>Nombre d'octets rservs</returns>
+	__int64 OctetsReserves() const;
+
+	/// <summary>
+	/// Accesseur du nombre d'octets demands par les emplacements actuellement allous
+	/// </summary>
+	/// <returns>Nombre d'octets utiliss</returns>
+	__int64 OctetsUtilises() const;
+
+	/// <summary>
+	/// Accesseur du nombre d'octets rservs mais inutiliss (arrondis aux classes de tailles, emplacements librs et fins de blocs non encore dcoupes)
+	/// </summary>
+	/// <returns>Nombre d'octets perdus</returns>
+	__int64 OctetsPerdus() const;
 
 private:
 	/// <summary>
-	/// Fonction de comparaison compatible avec le callback des fonctions qsort_c, bsearch_c et lfind_c
+	/// Permet d'allouer un nouveau bloc, qui devient le bloc en cours de dcoupage de la classe de tailles spcifie
 	/// </summary>
-	/// <param name="adresseEntite">Adresse d'un emplacement contenant l'adresse d'une entit</param>
-	/// <param name="adresseAutreEntite">Adresse d'un autre emplacement contenant l'adresse d'une autre entit</param>
-	/// <param name="contexte">Adresse du contexte de callback</param>
-	/// <returns>-1 si l'entit est "infrieure"  l'autre entit, 1 si l'entit est "suprieure"  l'autre entit, sinon 0 (en cas d'galit)</returns>
-	static int Comparer(const void* adresseEntite, const void* adresseAutreEntite, const void* contexte);
+	/// <param name="classe">Classe de tailles</param>
+	/// <returns>Vrai si l'allocation a pu se faire, sinon faux</returns>
+	bool AjouterBloc(long classe);
 
 private:
 	/// <summary>
-	/// Membre contenant le nombre actuel d'entits  prendre en considration
+	/// Membre contenant le nombre de blocs allous
 	/// </summary>
-	long m_Nombre;
+	long m_NombreBlocs;
 
 	/// <summary>
-	/// Membre contenant la taille actuelle du tableau des pointeurs
+	/// Membre contenant la taille actuelle du tableau des adresses de blocs
 	/// </summary>
 	long m_Taille;
 
 	/// <summary>
-	/// Membre contenant l'adresse de dbut du tableau des pointeurs vers chaque objet d'entit
+	/// Membre contenant l'adresse de dbut du tableau des adresses de blocs, tries par adresse croissante (cf. Contient)
 	/// </summary>
-	CEntite** m_Tableau;
+	char** m_Blocs;
+
+	/// <summary>
+	/// Membre contenant, pour chaque classe de tailles, l'adresse du premier emplacement libr (chaque emplacement libr contenant l'adresse du suivant), sinon NULL
+	/// </summary>
+	void* m_Libres[CArene::TailleMaximale / CArene::Granularite];
+
+	/// <summary>
+	/// Membre contenant, pour chaque classe de tailles, l'adresse du prochain emplacement  dcouper dans son bloc en cours, sinon NULL
+	/// </summary>
+	char* m_Courants[CArene::TailleMaximale / CArene::Granularite];
+
+	/// <summary>
+	/// Membre contenant, pour chaque classe de tailles, le nombre d'octets restant  dcouper dans son bloc en cours
+	/// </summary>
+	long m_Restants[CArene::TailleMaximale / CArene::Granularite];
+
+	/// <summary>
+	/// Membre contenant le nombre d'octets demands par les emplacements actuellement allous
+	/// </summary>
+	__int64 m_OctetsUtilises;
+};
+
+/// <summary>
+/// Dfinit l'tat d'un tableau publi  l'intention de ses lecteurs concurrents (cf. CTableau::ActiverConcurrence) : ni cet tat, ni les pointeurs et les entits qu'il dsigne ne sont modifis tant qu'un lecteur peut le consulter
+/// </summary>
+class CInstantaneTableau
+{
+public:
+	/// <summary>
+	/// Membre contenant l'adresse de dbut du tableau des pointeurs vers les entits
+	/// </summary>
+	CEntite* const* m_Tableau;
+
+	/// <summary>
+	/// Membre contenant le nombre d'entits
+	/// </summary>
+	long m_Nombre;
 
 	/// <summary>
-	/// Membre retenant l'tat actuel garanti du tableau d'entits
+	/// Membre contenant la modalit de comparaison du prfixe tri, sinon CTableau::NonTrie
 	/// </summary>
 	char m_TriActuel;
 
 	/// <summary>
-	/// Membre pointant sur l'entit de rfrence
+	/// Membre contenant le nombre d'entits du prfixe tri
 	/// </summary>
-	CEntite* m_EntiteParDefaut;
+	long m_NombreTries;
+};
+
+/// <summary>
+/// Dfinit la publication des tats successifs d'un tableau  l'intention de lecteurs concurrents, sans verrou : chaque lecteur annonce l'poque  laquelle il commence une lecture, et tout ce que le rdacteur retire (tats, tableaux de pointeurs, entits) n'est rcupr qu'une fois qu'aucun lecteur n'a pu commencer de lecture avant ce retrait
+/// <para>Seul le rdacteur (le fil d'excution qui modifie le tableau) publie, retire et rcupre ; les lecteurs ne font qu'annoncer et lire</para>
+/// </summary>
+class CPublicationTableau
+{
+public:
+	/// <summary>
+	/// Nombre maximal de lecteurs simultans
+	/// </summary>
+	static const long NombreMaximalLecteurs = 32;
+
+public:
+	/// <summary>
+	/// Constructeur par dfaut
+	/// </summary>
+	CPublicationTableau();
+
+	/// <summary>
+	/// Destructeur : rend les tats et blocs retirs, ainsi que l'tat publi (mais pas le tableau des pointeurs qu'il dsigne), sans attendre les lecteurs
+	/// </summary>
+	~CPublicationTableau();
+
+	/// <summary>
+	/// Permet  un lecteur de rserver l'un des emplacements de lecteur
+	/// </summary>
+	/// <returns>Numro de l'emplacement rserv, sinon -1 (tous les emplacements sont rservs)</returns>
+	long ReserverEmplacement();
+
+	/// <summary>
+	/// Permet  un lecteur de rendre l'emplacement de lecteur qu'il avait rserv
+	/// </summary>
+	/// <param name="emplacement">Numro de l'emplacement rserv</param>
+	void RendreEmplacement(long emplacement);
+
+	/// <summary>
+	/// Permet  un lecteur de commencer une lecture : il annonce l'poque actuelle, puis obtient l'tat publi, qui reste valide jusqu' TerminerLecture
+	/// </summary>
+	/// <param name="emplacement">Numro de l'emplacement rserv par ce lecteur</param>
+	/// <returns>Adresse de l'tat publi</returns>
+	const CInstantaneTableau* CommencerLecture(long emplacement);
+
+	/// <summary>
+	/// Permet  un lecteur de terminer sa lecture, l'tat obtenu devenant rcuprable
+	/// </summary>
+	/// <param name="emplacement">Numro de l'emplacement rserv par ce lecteur</param>
+	void TerminerLecture(long emplacement);
+
+	/// <summary>
+	/// Permet au rdacteur de publier un nouvel tat, l'tat prcdent tant retir (ainsi que son tableau des pointeurs, s'il en change)
+	/// </summary>
+	/// <param name="tableau">Adresse de dbut du tableau des pointeurs, qui ne doit plus tre ni modifi en de du nombre d'entits, ni rallou, ni libr</param>
+	/// <param name="nombre">Nombre d'entits</param>
+	/// <param name="triActuel">Modalit de comparaison du prfixe tri, sinon CTableau::NonTrie</param>
+	/// <param name="nombreTries">Nombre d'entits du prfixe tri</param>
+	/// <returns>Vrai si la publication a pu se faire, sinon faux (faute de mmoire, l'tat prcdent restant publi)</returns>
+	bool Publier(CEntite** tableau, long nombre, char triActuel, long nombreTries);
+
+	/// <summary>
+	/// Accesseur de l'tat publi, pour le rdacteur
+	/// </summary>
+	/// <returns>Adresse de l'tat publi</returns>
+	const CInstantaneTableau* Instantane() const;
+
+	/// <summary>
+	/// Permet au rdacteur de retirer une entit que des lecteurs peuvent encore consulter, afin qu'elle ne soit dtruite qu'une fois rcuprable (cf. ExtraireRecuperable)
+	/// </summary>
+	/// <param name="entite">Adresse de l'entit retire</param>
+	/// <returns>Vrai si le retrait a pu se faire, sinon faux (faute de mmoire, l'entit ne pouvant alors jamais tre dtruite sans risque)</returns>
+	bool Retirer(CEntite* entite);
+
+	/// <summary>
+	/// Permet au rdacteur d'obtenir la plus ancienne entit retire qu'aucun lecteur ne peut plus consulter, les tats et tableaux de pointeurs retirs avant elle tant rendus au passage
+	/// </summary>
+	/// <param name="forcer">Indique si tout ce qui a t retir est rcuprable, ce qui suppose qu'il n'y a plus aucun lecteur</param>
+	/// <returns>Adresse de l'entit  dtruire, sinon NULL (plus rien de rcuprable)</returns>
+	CEntite* ExtraireRecuperable(bool forcer = false);
+
+private:
+	/// <summary>
+	/// Dfinit un lment retir par le rdacteur, en attente de rcupration
+	/// </summary>
+	class CElementRetire
+	{
+	public:
+		void* m_Adresse;
+		__int64 m_Epoque;
+		char m_Nature;
+	};
+
+	/// <summary>
+	/// Permet de s'assurer que la file des lments retirs peut recevoir le nombre spcifi d'lments supplmentaires
+	/// </summary>
+	/// <param name="nombre">Nombre d'lments supplmentaires</param>
+	/// <returns>Vrai si la place est disponible, sinon faux</returns>
+	bool ReserverRetires(long nombre);
+
+	/// <summary>
+	/// Permet d'ajouter un lment  la file des lments retirs, avec l'poque actuelle
+	/// </summary>
+	/// <param name="adresse">Adresse de l'lment retir</param>
+	/// <param name="nature">Nature de l'lment (tat, tableau des pointeurs ou entit)</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool AjouterRetire(void* adresse, char nature);
+
+	/// <summary>
+	/// Retourne la plus petite poque annonce par un lecteur en cours de lecture, sinon l'poque actuelle
+	/// </summary>
+	/// <returns>poque en de de laquelle tout lment retir est rcuprable</returns>
+	__int64 EpoqueMinimale() const;
+
+private:
+	/// <summary>
+	/// Membre contenant l'poque actuelle, incrmente  chaque publication
+	/// <para>Sur 64 bits, elle ne peut revenir  0 (valeur rserve aux emplacements sans lecture en cours) ni perdre l'ordre de la file des lments retirs</para>
+	/// </summary>
+	volatile __int64 m_Epoque;
+
+	/// <summary>
+	/// Membre indiquant, pour chaque emplacement de lecteur, s'il est rserv (1) ou non (0)
+	/// </summary>
+	volatile long m_Reserves[CPublicationTableau::NombreMaximalLecteurs];
+
+	/// <summary>
+	/// Membre contenant, pour chaque emplacement de lecteur, l'poque annonce par la lecture en cours, sinon 0
+	/// </summary>
+	volatile __int64 m_Epoques[CPublicationTableau::NombreMaximalLecteurs];
+
+	/// <summary>
+	/// Membre contenant l'adresse de l'tat publi
+	/// </summary>
+	CInstantaneTableau* volatile m_Instantane;
+
+	/// <summary>
+	/// Membre contenant l'adresse de dbut de la file des lments retirs, par poques croissantes
+	/// </summary>
+	CElementRetire* m_Retires;
+
+	/// <summary>
+	/// Membre contenant l'indice du premier lment de la file des lments retirs
+	/// </summary>
+	long m_PremierRetire;
+
+	/// <summary>
+	/// Membre contenant le nombre d'lments de la file des lments retirs
+	/// </summary>
+	long m_NombreRetires;
+
+	/// <summary>
+	/// Membre contenant la taille actuelle de la file des lments retirs
+	/// </summary>
+	long m_TailleRetires;
+
+	/// <summary>
+	/// Membre contenant la dernire poque minimale calcule (cf. EpoqueMinimale), en de de laquelle les lments retirs sont rcuprables sans nouveau calcul
+	/// </summary>
+	__int64 m_EpoqueLimite;
+
+	/// <summary>
+	/// Membre contenant l'adresse du premier tat rcupr et rutilisable (chacun contenant l'adresse du suivant en guise de tableau des pointeurs), sinon NULL
+	/// </summary>
+	CInstantaneTableau* m_InstantanesLibres;
+};
+
+/// <summary>
+/// Dfinit un groupe d'entits gales selon une modalit de comparaison, contigus dans un tableau ou une vue tris selon celle-ci (cf. CTableau::Grouper), ainsi que les cumuls d'une projection numrique de ses entits
+/// </summary>
+class CGroupeEntites
+{
+public:
+	/// <summary>
+	/// Membre contenant l'adresse du premier des pointeurs vers les entits du groupe
+	/// </summary>
+	CEntite* const* m_Entites;
+
+	/// <summary>
+	/// Membre contenant l'indice de la premire entit du groupe dans le tableau ou la vue
+	/// </summary>
+	long m_IndiceDebut;
+
+	/// <summary>
+	/// Membre contenant le nombre d'entits du groupe (au moins 1)
+	/// </summary>
+	long m_Nombre;
+
+	/// <summary>
+	/// Membre contenant la somme des valeurs projetes des entits du groupe, sinon 0 (sans projection)
+	/// </summary>
+	double m_Somme;
+
+	/// <summary>
+	/// Membre contenant la plus petite des valeurs projetes des entits du groupe, sinon 0 (sans projection)
+	/// </summary>
+	double m_Minimum;
+
+	/// <summary>
+	/// Membre contenant la plus grande des valeurs projetes des entits du groupe, sinon 0 (sans projection)
+	/// </summary>
+	double m_Maximum;
+};
+
+/// <summary>
+/// Dfinit un tableau d'entits
+/// </summary>
+class CTableau : public CEntite
+{
+public:
+	/// <summary>
+	/// Modalit de comparaison non utilisable, permettant de signaler que le tableau n'est actuellement pas tri
+	/// </summary>
+	static const char NonTrie = -1;
+
+	/// <summary>
+	/// Taille minimale du tableau des pointeurs, ds lors qu'il est allou
+	/// </summary>
+	static const long TailleMinimale = 10;
+
+	/// <summary>
+	/// Taille du tableau des pointeurs interne  l'objet, utilis tant qu'il suffit, ce qui pargne le tas aux petits tableaux (notamment aux piles de courte dure)
+	/// </summary>
+	static const long TailleInterne = 10;
+
+	/// <summary>
+	/// Option de tri : les entits gales selon la modalit de comparaison conservent leur ordre relatif (tri par fusion)
+	/// </summary>
+	static const char TriStable = 1;
+
+	/// <summary>
+	/// Option de tri : au-del du seuil configur (cf. ConfigurerTriParallele), le tri est rparti sur plusieurs fils d'excution
+	/// </summary>
+	static const char TriParallele = 2;
+
+	/// <summary>
+	/// Option de tri : la cl de tri de chaque entit (cf. CEntite::RepresentationOctets) est calcule une seule fois, les comparaisons portant ensuite sur ces cls ; sans effet si le type d'entit n'en propose pas
+	/// </summary>
+	static const char TriParCles = 4;
+
+	/// <summary>
+	/// Option de tri : les cls de tri (cf. TriParCles, que cette option implique) sont ordonnes par distribution successive de leurs octets, en commenant par le premier (tri par base), et donc sans comparaison ; le tri obtenu est toujours stable, mais jamais parallle
+	/// </summary>
+	static const char TriParDistribution = 8;
+
+	/// <summary>
+	/// Nombre d'entits par dfaut en de duquel un tri parallle est ralis en srie
+	/// </summary>
+	static const long SeuilTriParalleleParDefaut = 100000;
+
+	/// <summary>
+	/// Dfinit un type de donnes pour les fonctions capables de dcider si une entit doit tre retenue, selon un contexte fourni par l'appelant
+	/// </summary>
+	typedef bool(*PredicatEntite)(const CEntite& entite, const void* contexte);
+
+	/// <summary>
+	/// Dfinit un type de donnes pour les fonctions capables de projeter une entit sur une valeur numrique  cumuler (cf. Grouper), selon un contexte fourni par l'appelant
+	/// </summary>
+	typedef double(*ProjectionEntite)(const CEntite& entite, const void* contexte);
+
+	/// <summary>
+	/// Dfinit un type de donnes pour les fonctions capables de traiter un groupe d'entits gales (cf. Grouper), selon un contexte fourni par l'appelant, et d'indiquer si le parcours des groupes doit se poursuivre
+	/// </summary>
+	typedef bool(*TraitementGroupe)(const CGroupeEntites& groupe, void* contexte);
+
+public:
+	/// <summary>
+	/// Constructeur spcifique
+	/// </summary>
+	/// <param name="entiteParDefaut">Modle d'entit par dfaut (c'est ce qui dtermine le "dnominateur commun"  tout lment que l'on veut placer dans ce tableau)</param>
+	CTableau(const CEntite& entiteParDefaut);
+
+	/// <summary>
+	/// Constructeur par copie
+	/// <para>Les entits de la source ne sont pas clones : elles sont partages, jusqu' la premire modification de l'un des tableaux qui les partagent (cf. Detacher)</para>
+	/// </summary>
+	/// <param name="source">Entit source de cette copie</param>
+	CTableau(const CTableau& source);
+
+	/// <summary>
+	/// Destructeur
+	/// </summary>
+	~CTableau();
+
+	/// <summary>
+	/// Permet de crer un duplicata de cette entit
+	/// </summary>
+	/// <returns>Objet cr dynamiquement par clonage</returns>
+	CEntite* Cloner() const;
+
+	/// <summary>
+	/// Permet de supprimer toutes les entits du tableau
+	/// </summary>
+	void Vider();
+
+	/// <summary>
+	/// Permet d'ajouter une nouvelle entit en fin de tableau,  partir du modle spcifi d'entit
+	/// </summary>
+	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Ajouter(const CEntite& entiteAAjouter);
+
+	/// <summary>
+	/// Permet d'insrer une nouvelle entit  la position spcifie du tableau,  partir du modle spcifi d'entit
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+	bool Inserer(long indiceInsertion, const CEntite& entiteAAjouter);
+
+	/// <summary>
+	/// Permet d'ajouter une nouvelle entit en fin de tableau,  partir de l'entit temporaire spcifie, dont les ressources sont transfres (cf. ClonerParDeplacement)
+	/// </summary>
+	/// <param name="entiteAAjouter">Entit temporaire  ajouter dans le tableau</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Ajouter(CEntite&& entiteAAjouter);
+
+	/// <summary>
+	/// Permet d'insrer une nouvelle entit  la position spcifie du tableau,  partir de l'entit temporaire spcifie, dont les ressources sont transfres (cf. ClonerParDeplacement)
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+	/// <param name="entiteAAjouter">Entit temporaire  ajouter dans le tableau</param>
+	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+	bool Inserer(long indiceInsertion, CEntite&& entiteAAjouter);
+
+	/// <summary>
+	/// Permet d'ajouter en fin de tableau l'entit spcifie, cre dynamiquement, sans la cloner : le tableau en devient propritaire
+	/// <para>En cas d'chec, l'entit est dtruite</para>
+	/// </summary>
+	/// <param name="entiteAAdopter">Adresse de l'entit cre dynamiquement</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Adopter(CEntite* entiteAAdopter);
+
+	/// <summary>
+	/// Permet d'insrer  la position spcifie du tableau l'entit spcifie, cre dynamiquement, sans la cloner : le tableau en devient propritaire
+	/// <para>En cas d'chec, l'entit est dtruite</para>
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+	/// <param name="entiteAAdopter">Adresse de l'entit cre dynamiquement</param>
+	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+	bool InsererAdopte(long indiceInsertion, CEntite* entiteAAdopter);
+
+	/// <summary>
+	/// Permet d'ajouter en fin de tableau un lot d'entits,  partir des modles spcifis, avec le mme rsultat que des appels successifs  Ajouter
+	/// <para>Les modles sont valids en une passe, puis les doublons (au sein du lot comme avec les entits dj prsentes) sont dtects par modalit d'unicit au moyen d'un seul tri du lot, avant un ajout en une seule rservation de capacit</para>
+	/// </summary>
+	/// <param name="entites">Adresse du tableau des adresses des modles d'entits  ajouter</param>
+	/// <param name="nombre">Nombre de modles d'entits</param>
+	/// <param name="rejetees">[RESULTAT] Adresse d'un tableau de nombre indicateurs, dont chacun indique si le modle correspondant a t rejet (invalide, doublon ou faute de mmoire), sinon NULL</param>
+	/// <returns>Nombre d'entits ajoutes, sinon -1 (paramtres invalides ou faute de mmoire, aucune entit n'tant alors ajoute)</returns>
+	long AjouterLot(const CEntite* const* entites, long nombre, bool* rejetees = NULL);
+
+	/// <summary>
+	/// Permet d'ajouter en fin de tableau un lot d'entits cres dynamiquement, sans les cloner, avec le mme rsultat que des appels successifs  Adopter : le tableau devient propritaire des entits retenues, les entits rejetes tant dtruites
+	/// <para>Les entits sont traites comme par AjouterLot, leur validation et la dtection des doublons se faisant en une passe</para>
+	/// </summary>
+	/// <param name="entites">Adresse du tableau des adresses des entits cres dynamiquement</param>
+	/// <param name="nombre">Nombre d'entits</param>
+	/// <param name="rejetees">[RESULTAT] Adresse d'un tableau de nombre indicateurs, dont chacun indique si l'entit correspondante a t rejete (et dtruite), sinon NULL</param>
+	/// <returns>Nombre d'entits adoptes, sinon -1 (paramtres invalides ou faute de mmoire, aucune entit n'tant alors ni adopte, ni dtruite)</returns>
+	long AdopterLot(CEntite* const* entites, long nombre, bool* rejetees = NULL);
+
+	/// <summary>
+	/// Permet d'insrer une nouvelle entit  sa position dans l'ordre de tri selon la modalit de comparaison spcifie,  partir du modle spcifi d'entit
+	/// <para>Le tableau est pralablement tri selon cette modalit si ncessaire ; il le reste aprs l'insertion, ce qui prserve les recherches dichotomiques</para>
+	/// <para>Une entit gale  des entits dj prsentes est insre aprs celles-ci</para>
+	/// </summary>
+	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'ordre de tri  respecter</param>
+	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+	bool InsererTrie(const CEntite& entiteAAjouter, char modaliteComparaison = (char)0);
+
+	/// <summary>
+	/// Permet d'indiquer si les ajouts en fin de tableau doivent plutt prserver l'tat actuel de tri, en insrant chaque nouvelle entit  sa position (cf. InsererTrie)
+	/// <para>Sans effet tant que le tableau n'est pas tri ; Inserer, qui impose une position, n'est pas concerne ; un tableau vid reste tri selon la mme modalit, que les ajouts suivants maintiennent donc</para>
+	/// </summary>
+	/// <param name="maintien">Indique si l'tat actuel de tri doit tre maintenu par les ajouts</param>
+	void MaintenirTri(bool maintien = true);
+
+	/// <summary>
+	/// Indique si les ajouts en fin de tableau prservent l'tat actuel de tri
+	/// </summary>
+	/// <returns>Vrai si l'tat actuel de tri est maintenu par les ajouts, sinon faux</returns>
+	bool TriMaintenu() const;
+
+	/// <summary>
+	/// Permet de supprimer l'entit spcifie du tableau
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  supprimer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
+	bool Supprimer(long indiceElement);
+
+	/// <summary>
+	/// Permet de supprimer du tableau, en un seul parcours, toutes les entits vrifiant le prdicat spcifi
+	/// <para>Les entits conserves gardent leur ordre relatif, si bien que l'tat actuel de tri est prserv ; le tableau des pointeurs n'est rduit qu'une fois,  la fin</para>
+	/// </summary>
+	/// <param name="predicat">Fonction indiquant si une entit doit tre supprime</param>
+	/// <param name="contexte">Contexte transmis tel quel au prdicat  chaque appel</param>
+	/// <returns>Nombre d'entits supprimes, sinon -1 (paramtre invalide ou manque de mmoire)</returns>
+	long SupprimerSi(PredicatEntite predicat, const void* contexte = NULL);
+
+	/// <summary>
+	/// Permet de supprimer du tableau toutes les entits d'une plage d'indices, avec un seul dcalage des entits suivantes
+	/// <para>L'tat actuel de tri est prserv</para>
+	/// </summary>
+	/// <param name="indiceDebut">Indice de la premire entit  supprimer<para>Compris entre 0 et le nombre d'entits</para></param>
+	/// <param name="indiceFin">Indice suivant celui de la dernire entit  supprimer<para>Compris entre l'indice de dbut et le nombre d'entits</para></param>
+	/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
+	bool SupprimerPlage(long indiceDebut, long indiceFin);
+
+	/// <summary>
+	/// Permet de s'assurer que le tableau des pointeurs peut contenir au moins le nombre spcifi d'entits, sans nouvelle rallocation
+	/// <para>Cette taille rserve est conserve par la suite : les suppressions ne rduisent jamais le tableau des pointeurs en de</para>
+	/// </summary>
+	/// <param name="nombre">Nombre d'entits  pouvoir contenir</param>
+	/// <returns>Vrai si la rservation a pu se faire, sinon faux</returns>
+	bool Reserver(long nombre);
+
+	/// <summary>
+	/// Permet de rduire le tableau des pointeurs au strict nombre actuel d'entits, en annulant toute taille rserve
+	/// </summary>
+	/// <returns>Vrai si le compactage a pu se faire, sinon faux</returns>
+	bool Compacter();
+
+	/// <summary>
+	/// Accesseur de la taille actuelle du tableau des pointeurs
+	/// </summary>
+	/// <returns>Nombre d'entits que le tableau peut contenir sans nouvelle rallocation</returns>
+	long Capacite() const;
+
+	/// <summary>
+	/// Permet de trier les entits selon la modalit de comparaison spcifie
+	/// <para>Si seules les dernires entits ont t ajoutes depuis un tri selon cette modalit, elles seules sont tries, puis fusionnes en temps linaire avec le prfixe dj tri</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors du tri des entits</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (TriStable, TriParallele, TriParCles, TriParDistribution)<para>Un tri stable parallle produit exactement le mme ordre qu'un tri stable en srie</para></param>
+	/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+	bool Trier(char modaliteComparaison = (char)0, char optionsTri = (char)0);
+
+	/// <summary>
+	/// Permet de trier, selon la modalit de comparaison spcifie, un tableau d'adresses d'entits de ce tableau (cf. CVueTableau) dont un prfixe est ventuellement dj tri, sans modifier ce tableau ni ses entits
+	/// <para>Le tri procde comme celui du tableau lui-mme (fonction de comparaison directe, cls de tri et paralllisme selon les options)</para>
+	/// </summary>
+	/// <param name="entites">Adresse du tableau des adresses d'entits  trier</param>
+	/// <param name="nombre">Nombre d'adresses d'entits</param>
+	/// <param name="debut">Nombre d'adresses du prfixe dj tri selon cette modalit</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (TriStable, TriParallele, TriParCles, TriParDistribution)</param>
+	/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+	bool TrierAdresses(CEntite** entites, long nombre, long debut, char modaliteComparaison, char optionsTri = (char)0) const;
+
+	/// <summary>
+	/// Permet de parcourir le tableau par groupes d'entits gales selon la modalit de comparaison spcifie, en une seule passe aprs un tri selon celle-ci (sans tri s'il est dj tri ainsi)
+	/// <para>Chaque groupe est soumis au traitement avec son effectif et, si une projection est spcifie, la somme, le minimum et le maximum des valeurs projetes de ses entits ; le traitement ne doit pas modifier le tableau</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'galit des entits d'un groupe</param>
+	/// <param name="traitement">Fonction appele pour chaque groupe, dans l'ordre du tri, et qui peut interrompre le parcours en retournant faux, sinon NULL pour seulement compter les groupes</param>
+	/// <param name="contexteTraitement">Contexte transmis tel quel au traitement  chaque appel</param>
+	/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+	/// <param name="contexteProjection">Contexte transmis tel quel  la projection  chaque appel</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (cf. Trier)</param>
+	/// <returns>Nombre de groupes soumis au traitement, sinon -1 (modalit invalide ou chec du tri)</returns>
+	long Grouper(char modaliteComparaison, TraitementGroupe traitement, void* contexteTraitement = NULL, ProjectionEntite projection = NULL, const void* contexteProjection = NULL, char optionsTri = (char)0);
+
+	/// <summary>
+	/// Permet de parcourir, par groupes d'entits gales selon la modalit de comparaison spcifie, un tableau d'adresses d'entits de ce tableau dj tri selon celle-ci (cf. CVueTableau::Grouper), sans modifier ce tableau ni ses entits
+	/// </summary>
+	/// <param name="entites">Adresse du tableau des adresses d'entits tries</param>
+	/// <param name="nombre">Nombre d'adresses d'entits</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'galit des entits d'un groupe</param>
+	/// <param name="traitement">Fonction appele pour chaque groupe, sinon NULL pour seulement compter les groupes</param>
+	/// <param name="contexteTraitement">Contexte transmis tel quel au traitement  chaque appel</param>
+	/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+	/// <param name="contexteProjection">Contexte transmis tel quel  la projection  chaque appel</param>
+	/// <returns>Nombre de groupes soumis au traitement, sinon -1 (modalit invalide)</returns>
+	long GrouperAdresses(CEntite* const* entites, long nombre, char modaliteComparaison, TraitementGroupe traitement, void* contexteTraitement = NULL, ProjectionEntite projection = NULL, const void* contexteProjection = NULL) const;
+
+	/// <summary>
+	/// Permet de trier de manire stable les entits selon une cl composite : les entits gales selon une modalit de comparaison sont dpartages par la suivante
+	/// <para>Le tableau est ensuite considr comme tri selon la premire modalit (cf. TriActuel), ce qui prserve les recherches dichotomiques sur celle-ci</para>
+	/// </summary>
+	/// <param name="modalites">Adresse du tableau des modalits de comparaison successives</param>
+	/// <param name="nombre">Nombre de modalits de comparaison</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (TriParallele), la stabilit tant toujours assure</param>
+	/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+	bool TrierMulti(const char* modalites, int nombre, char optionsTri = (char)0);
+
+	/// <summary>
+	/// Permet de placer en tte du tableau, tries selon la modalit de comparaison spcifie, ses plus petites entits selon celle-ci, l'ordre des suivantes tant indtermin (tri partiel, en O(n log k))
+	/// <para>Le tableau est ensuite considr comme tri selon cette modalit sur ce prfixe seulement (cf. NombreTries) : un tri ultrieur selon la mme modalit ne trie alors que les entits suivantes, sans avoir  les fusionner avec le prfixe</para>
+	/// </summary>
+	/// <param name="nombre">Nombre d'entits  placer en tte<para>Un nombre au moins gal au nombre d'entits revient  un tri complet</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <returns>Vrai si le tri partiel est ralis, sinon faux</returns>
+	bool TrierPartiel(long nombre, char modaliteComparaison = (char)0);
+
+	/// <summary>
+	/// Permet de placer  l'indice spcifi l'entit qui s'y trouverait si le tableau tait tri selon la modalit de comparaison spcifie, les entits qui la prcdent ne lui tant pas suprieures et celles qui la suivent ne lui tant pas infrieures (slection, en O(n) en moyenne)
+	/// <para>Sauf si le tableau tait dj tri selon cette modalit, il ne l'est plus ensuite</para>
+	/// </summary>
+	/// <param name="rang">Indice de l'entit  placer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <returns>Vrai si la slection est ralise, sinon faux</returns>
+	bool SelectionnerK(long rang, char modaliteComparaison = (char)0);
+
+	/// <summary>
+	/// Permet d'obtenir l'union de ce tableau et d'un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion
+	/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans un tableau et m fois dans l'autre l'est max(n, m) fois dans le rsultat, celles de ce tableau tant retenues en priorit</para>
+	/// </summary>
+	/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+	/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+	/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+	bool Union(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Permet d'obtenir l'intersection de ce tableau et d'un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion
+	/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans un tableau et m fois dans l'autre l'est min(n, m) fois dans le rsultat, sous la forme de celles de ce tableau</para>
+	/// </summary>
+	/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+	/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+	/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+	bool Intersection(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Permet d'obtenir les entits de ce tableau absentes d'un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion
+	/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans ce tableau et m fois dans l'autre l'est max(n - m, 0) fois dans le rsultat</para>
+	/// </summary>
+	/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+	/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+	/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+	bool Difference(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Permet d'obtenir les entits prsentes dans un seul des deux tableaux, ce tableau et un autre tant tris selon la mme modalit de comparaison, en un seul parcours de fusion
+	/// <para>Les entits gales sont apparies une  une : une entit prsente n fois dans un tableau et m fois dans l'autre l'est |n - m| fois dans le rsultat</para>
+	/// </summary>
+	/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+	/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres, dont le contenu est d'abord supprim<para>Il ne reoit que des clones des entits retenues qu'il considre comme valides et uniques, et se trouve ensuite tri selon cette modalit</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris, et qui dfinit l'galit des entits</param>
+	/// <returns>Vrai si l'opration est ralise, sinon faux (tableau non tri selon cette modalit, rsultat confondu avec l'un des tableaux, ou manque de mmoire)</returns>
+	bool DifferenceSymetrique(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Permet de configurer les tris parallles de ce tableau (cf. option TriParallele)
+	/// </summary>
+	/// <param name="nombreFils">Nombre de fils d'excution  utiliser<para>0 pour autant de fils que de processeurs, 1 pour toujours trier en srie</para></param>
+	/// <param name="seuil">Nombre d'entits en de duquel le tri est ralis en srie</param>
+	/// <returns>Vrai si la configuration est valide et a t retenue, sinon faux</returns>
+	bool ConfigurerTriParallele(long nombreFils, long seuil = CTableau::SeuilTriParalleleParDefaut);
+
+	/// <summary>
+	/// Permet de rechercher une entit dans le tableau en fonction de la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors de la recherche de l'entit</param>
+	/// <param name="indiceDebut">Indice de dbut de la recherche<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Indice de la premire occurrence d'entit correspondant  la recherche entame, sinon -1</returns>
+	long Rechercher(const CEntite& entiteARechercher, char modaliteComparaison = (char)0, long indiceDebut = 0) const;
+
+	/// <summary>
+	/// Permet de rechercher une entit dans le tableau  partir d'une simple cl (le contenu d'une chane, par exemple), sans construire d'entit modle, en fonction de la modalit de comparaison spcifie
+	/// <para>Le type d'entit doit prendre en charge la comparaison  une cl (cf. CEntite::ComparerACle), et son hachage pour tirer parti d'un index de hachage (cf. CEntite::HacherCle) ; les index de tri et le prfixe tri sont exploits comme par la recherche d'une entit</para>
+	/// </summary>
+	/// <param name="cle">Cl  rechercher</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors de la recherche de l'entit</param>
+	/// <param name="indiceDebut">Indice de dbut de la recherche<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Indice de la premire occurrence d'entit gale  la cl  partir de l'indice de dbut, sinon -1 (notamment si le type d'entit ne prend pas en charge les cls)</returns>
+	long Rechercher(const char* cle, char modaliteComparaison = (char)0, long indiceDebut = 0) const;
+
+	/// <summary>
+	/// Recherche dichotomique de la borne infrieure de l'entit spcifie, c'est--dire de l'indice de la premire entit qui ne lui est pas infrieure
+	/// <para>Pour une entit absente, c'est l'indice auquel l'insrer pour prserver le tri ; pour une entit prsente, c'est l'indice de sa premire occurrence</para>
+	/// </summary>
+	/// <param name="entite">Modle de l'entit dont on cherche la borne</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle le tableau doit tre actuellement tri</param>
+	/// <returns>Indice compris entre 0 et le nombre d'entits, sinon -1 (entit invalide ou tableau non tri selon cette modalit)</returns>
+	long BorneInferieure(const CEntite& entite, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Recherche dichotomique de la borne suprieure de l'entit spcifie, c'est--dire de l'indice de la premire entit qui lui est strictement suprieure
+	/// </summary>
+	/// <param name="entite">Modle de l'entit dont on cherche la borne</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle le tableau doit tre actuellement tri</param>
+	/// <returns>Indice compris entre 0 et le nombre d'entits, sinon -1 (entit invalide ou tableau non tri selon cette modalit)</returns>
+	long BorneSuperieure(const CEntite& entite, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Recherche dichotomique de la plage des entits gales  l'entit spcifie
+	/// <para>Une plage vide (indiceDebut == indiceFin) dsigne la position d'insertion de l'entit absente</para>
+	/// </summary>
+	/// <param name="entite">Modle de l'entit dont on cherche la plage</param>
+	/// <param name="indiceDebut">[RESULTAT] Indice de la premire entit gale (cf. BorneInferieure)</param>
+	/// <param name="indiceFin">[RESULTAT] Indice suivant celui de la dernire entit gale (cf. BorneSuperieure)</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle le tableau doit tre actuellement tri</param>
+	/// <returns>Vrai si la recherche a pu tre mene, sinon faux (entit invalide ou tableau non tri selon cette modalit)</returns>
+	bool PlageEgale(const CEntite& entite, long& indiceDebut, long& indiceFin, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Accesseur du nombre d'entits de ce tableau
+	/// </summary>
+	/// <returns>Nombre d'entits</returns>
+	long Nombre() const;
+
+	/// <summary>
+	/// Indexeur d'une entit en fonction de son indice dans ce tableau
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
+	/// <returns>Rfrence de l'lment du tableau  l'indice valide, sinon l'entit par dfaut</returns>
+	const CEntite& Element(long indiceElement) const;
+
+	/// <summary>
+	/// Indexeur d'une entit en fonction de son indice dans ce tableau
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
+	/// <returns>Rfrence de l'lment du tableau  l'indice valide, sinon l'entit par dfaut</returns>
+	template <class T> const T& Element(long indiceElement) const
+	{
+		return (const T&)Element(indiceElement);
+	}
+
+	/// <summary>
+	/// Permet d'obtenir une entit de ce tableau afin de la modifier sur place, le partage de ses entits avec ses copies prenant d'abord fin (cf. constructeur par copie)
+	/// <para>Le prfixe tri est ramen aux entits qui la prcdent ; la validit, les unicits et les index actifs ne sont en revanche pas mis  jour, si bien que la modification ne doit pas porter sur ce que comparent les modalits d'unicit ou indexes</para>
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  modifier<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Adresse de l'lment  modifier, sinon NULL (indice invalide, mode concurrent, o les lecteurs peuvent consulter l'entit, ou faute de mmoire)</returns>
+	CEntite* ElementModifiable(long indiceElement);
+
+	/// <summary>
+	/// Permet d'obtenir une entit de ce tableau afin de la modifier sur place (cf. ElementModifiable)
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  modifier<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Adresse de l'lment  modifier, sinon NULL</returns>
+	template <class T> T* ElementModifiable(long indiceElement)
+	{
+		return (T*)ElementModifiable(indiceElement);
+	}
+
+	/// <summary>
+	/// Accesseur indiquant comment le tableau est actuellement tri
+	/// </summary>
+	/// <returns>Modalit de comparaison selon laquelle l'ensemble du tableau est tri, sinon NonTrie</returns>
+	char TriActuel() const;
+
+	/// <summary>
+	/// Accesseur de la longueur du prfixe du tableau qui est rest tri depuis le dernier tri (cf. Trier)
+	/// </summary>
+	/// <returns>Nombre d'entits du prfixe tri, gal au nombre d'entits si le tableau est entirement tri</returns>
+	long NombreTries() const;
+
+	/// <summary>
+	/// Indique si le tableau est actuellement tri (selon la modalit spcifie)
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  tester comme modalit de tri actuel</param>
+	/// <returns>Vrai si le tableau est actuellement tri selon la modalit de comparaison spcifie, sinon faux</returns>
+	bool EstTrie(char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Permet d'activer (ou de dsactiver) l'index de hachage maintenu par ce tableau pour la modalit de comparaison spcifie
+	/// <para>Un tel index rend en temps constant (en moyenne) les tests d'unicit de Inserer, ainsi que les recherches infructueuses de Rechercher</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  indexer</param>
+	/// <param name="activation">Indique si l'index doit tre activ ou dsactiv</param>
+	/// <returns>Vrai si l'index est dans l'tat demand, sinon faux (notamment si l'entit par dfaut ne prend pas en charge le hachage selon cette modalit)</returns>
+	bool ActiverIndexHachage(char modaliteComparaison, bool activation = true);
+
+	/// <summary>
+	/// Indique si ce tableau maintient actuellement un index de hachage pour la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  tester</param>
+	/// <returns>Vrai si un index de hachage est maintenu pour cette modalit de comparaison, sinon faux</returns>
+	bool EstIndexeParHachage(char modaliteComparaison) const;
+
+	/// <summary>
+	/// Permet d'activer (ou de dsactiver) l'index de tri maintenu par ce tableau pour la modalit de comparaison spcifie
+	/// <para>Un tel index rend dichotomiques les recherches de Rechercher selon cette modalit, sans imposer de tri au tableau lui-mme</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  indexer</param>
+	/// <param name="activation">Indique si l'index doit tre activ ou dsactiv</param>
+	/// <returns>Vrai si l'index est dans l'tat demand, sinon faux</returns>
+	bool ActiverIndexTri(char modaliteComparaison, bool activation = true);
+
+	/// <summary>
+	/// Indique si ce tableau maintient actuellement un index de tri pour la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  tester</param>
+	/// <returns>Vrai si un index de tri est maintenu pour cette modalit de comparaison, sinon faux</returns>
+	bool EstIndexeParTri(char modaliteComparaison) const;
+
+	/// <summary>
+	/// Retourne l'indice de l'entit de rang spcifi selon l'index de tri de la modalit de comparaison spcifie
+	/// <para>Permet de parcourir les entits dans l'ordre de cette modalit sans trier le tableau</para>
+	/// </summary>
+	/// <param name="rang">Rang de l'entit selon l'ordre de l'index<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <param name="modaliteComparaison">Modalit de comparaison de l'index de tri  utiliser</param>
+	/// <returns>Indice de l'entit dans ce tableau, sinon -1 (notamment si cette modalit n'est pas indexe)</returns>
+	long IndiceTrie(long rang, char modaliteComparaison) const;
+
+	/// <summary>
+	/// Permet d'activer ou de dsactiver l'allocation dans une arne propre  ce tableau (cf. CArene) des entits qu'il clone, ce qui rduit le cot des allocations et la fragmentation de la mmoire pour de nombreuses petites entits, Vider rendant alors la mmoire en une seule fois
+	/// <para>La dsactivation n'est possible que si le tableau est vide ; les entits adoptes ou ne prenant pas en charge ClonerDans restent alloues individuellement</para>
+	/// </summary>
+	/// <param name="activation">Indique si l'arne doit tre active ou dsactive</param>
+	/// <returns>Vrai si l'arne est dans l'tat demand, sinon faux</returns>
+	bool ActiverArene(bool activation = true);
+
+	/// <summary>
+	/// Accesseur de l'arne de ce tableau, afin notamment d'en consulter les statistiques
+	/// </summary>
+	/// <returns>Adresse de l'arne, sinon NULL si elle n'est pas active</returns>
+	const CArene* Arene() const;
+
+	/// <summary>
+	/// Indique si les entits de ce tableau sont actuellement partages avec au moins une de ses copies (cf. constructeur par copie)
+	/// </summary>
+	/// <returns>Vrai si les entits sont partages, sinon faux</returns>
+	bool EstPartage() const;
+
+	/// <summary>
+	/// Permet d'activer ou de dsactiver le mode concurrent, dans lequel des lecteurs (cf. CLecteurTableau) peuvent consulter ce tableau, sans verrou, pendant que le fil d'excution qui le modifie (le seul  pouvoir appeler ses mthodes) poursuit ses modifications
+	/// <para>Chaque modification publie un nouvel tat du tableau : les ajouts en fin de tableau restent en temps constant amorti, toute autre modification des pointeurs (insertion, suppression, tri) portant sur une copie du tableau des pointeurs ; les entits supprimes ne sont dtruites qu'une fois qu'aucun lecteur ne peut plus les consulter</para>
+	/// <para>La dsactivation (comme la destruction du tableau) suppose qu'aucun lecteur ne le consulte plus ; l'arne ne peut tre ni active, ni dsactive dans ce mode, et les copies du tableau n'en partagent pas les entits</para>
+	/// </summary>
+	/// <param name="activation">Indique si le mode concurrent doit tre activ ou dsactiv</param>
+	/// <returns>Vrai si le tableau est dans le mode demand, sinon faux</returns>
+	bool ActiverConcurrence(bool activation = true);
+
+	/// <summary>
+	/// Indique si ce tableau est en mode concurrent (cf. ActiverConcurrence)
+	/// </summary>
+	/// <returns>Vrai si le mode concurrent est activ, sinon faux</returns>
+	bool EstConcurrent() const;
+
+	/// <summary>
+	/// Accesseur de la publication des tats de ce tableau  l'intention de ses lecteurs (cf. CLecteurTableau)
+	/// </summary>
+	/// <returns>Adresse de la publication, sinon NULL si le mode concurrent n'est pas activ</returns>
+	CPublicationTableau* Publication() const;
+
+private:
+	/// <summary>
+	/// Fonction de comparaison compatible avec le callback de la fonction lfind_c
+	/// </summary>
+	/// <param name="adresseEntite">Adresse d'un emplacement contenant l'adresse d'une entit</param>
+	/// <param name="adresseAutreEntite">Adresse d'un autre emplacement contenant l'adresse d'une autre entit</param>
+	/// <param name="contexte">Adresse du contexte de callback</param>
+	/// <returns>-1 si l'entit est "infrieure"  l'autre entit, 1 si l'entit est "suprieure"  l'autre entit, sinon 0 (en cas d'galit)</returns>
+	static int Comparer(const void* adresseEntite, const void* adresseAutreEntite, const void* contexte);
+
+	/// <summary>
+	/// Permet de modifier la taille effective du tableau des pointeurs
+	/// <para>Une taille au plus gale  TailleInterne est servie par le tableau des pointeurs interne, hors partage et hors mode concurrent</para>
+	/// </summary>
+	/// <param name="nouvelleTaille">Nouvelle taille du tableau des pointeurs<para>Au moins gale au nombre actuel d'entits</para></param>
+	/// <returns>Vrai si le redimensionnement a pu se faire, sinon faux</returns>
+	bool Redimensionner(long nouvelleTaille);
+
+	/// <summary>
+	/// Indique si l'entit spcifie peut tre insre  la position spcifie du tableau (position, validit et unicits)
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion</param>
+	/// <param name="entiteAAjouter">Entit  insrer</param>
+	/// <returns>Vrai si l'insertion est possible, sinon faux</returns>
+	bool PeutInserer(long indiceInsertion, const CEntite& entiteAAjouter) const;
+
+	/// <summary>
+	/// Permet de mettre fin au partage des entits de ce tableau avec ses copies, en clonant les entits partages (sans les revalider, ni tester leur unicit)
+	/// <para>Doit prcder toute modification du tableau des pointeurs ou des entits, ainsi que tout clonage dans l'arne ; en mode concurrent, le tableau des pointeurs publi est alors remplac par une copie s'il doit tre modifi en de du nombre d'entits publies</para>
+	/// </summary>
+	/// <param name="indiceModification">Indice de la premire case du tableau des pointeurs  modifier (le nombre d'entits pour un simple ajout en fin de tableau)</param>
+	/// <returns>Vrai si ce tableau ne partage plus ses entits, sinon faux (faute de mmoire, le partage tant alors maintenu)</returns>
+	bool Detacher(long indiceModification = 0);
+
+	/// <summary>
+	/// Permet d'achever une suppression d'entits en bloc : remise  NULL des cases libres, rduction unique du tableau des pointeurs, ou retour  l'tat initial s'il est vide, et reconstruction des index de tri
+	/// </summary>
+	/// <param name="ancienNombre">Nombre d'entits avant la suppression</param>
+	void TerminerSuppressions(long ancienNombre);
+
+	/// <summary>
+	/// Permet de combiner ce tableau et un autre, tris selon la mme modalit de comparaison, en un seul parcours de fusion qui apparie une  une les entits gales (cf. Union, Intersection, Difference et DifferenceSymetrique)
+	/// </summary>
+	/// <param name="autreTableau">Autre tableau, tri selon la mme modalit de comparaison</param>
+	/// <param name="resultat">Tableau recevant le rsultat, distinct des deux autres</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les deux tableaux sont tris</param>
+	/// <param name="propres">Indique si les entits de ce tableau sans gale apparie dans l'autre sont retenues</param>
+	/// <param name="autres">Indique si les entits de l'autre tableau sans gale apparie dans celui-ci sont retenues</param>
+	/// <param name="communes">Indique si les entits de ce tableau apparies  une gale de l'autre sont retenues</param>
+	/// <returns>Vrai si la combinaison est ralise, sinon faux</returns>
+	bool CombinerEnsembles(const CTableau& autreTableau, CTableau& resultat, char modaliteComparaison, bool propres, bool autres, bool communes) const;
+
+	/// <summary>
+	/// Indique si des entits tries selon la modalit de comparaison spcifie peuvent tre ajoutes en fin de ce tableau vide sans passer par AjouterLot (cf. CombinerEnsembles) : aucune autre modalit d'unicit, ni aucun tri maintenu selon une autre modalit
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle les entits sont tries</param>
+	/// <returns>Vrai si l'ajout direct prserve les rgles de ce tableau, sinon faux</returns>
+	bool PeutAjouterTrie(char modaliteComparaison) const;
+
+	/// <summary>
+	/// Permet d'ajouter en fin de tableau un lot d'entits, clones ou adoptes (cf. AjouterLot et AdopterLot)
+	/// </summary>
+	/// <param name="entites">Adresse du tableau des adresses des entits ou modles d'entits</param>
+	/// <param name="nombre">Nombre d'entits</param>
+	/// <param name="rejetees">[RESULTAT] Adresse d'un tableau de nombre indicateurs de rejet, sinon NULL</param>
+	/// <param name="adoption">Indique si les entits sont adoptes (les entits rejetes tant alors dtruites), sinon clones</param>
+	/// <returns>Nombre d'entits ajoutes, sinon -1</returns>
+	long PlacerLot(const CEntite* const* entites, long nombre, bool* rejetees, bool adoption);
+
+	/// <summary>
+	/// Permet de placer  la position spcifie du tableau l'entit spcifie, dont le tableau devient propritaire, les vrifications d'unicit ayant dj t faites et le tableau n'tant plus partag
+	/// <para>En cas d'chec, l'entit est dtruite</para>
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+	/// <param name="entite">Adresse de l'entit cre dynamiquement, sinon NULL (chec)</param>
+	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+	bool PlacerEntite(long indiceInsertion, CEntite* entite);
+
+	/// <summary>
+	/// Permet de crer un clone de l'entit spcifie, dans l'arne de ce tableau si possible, sinon par Cloner
+	/// </summary>
+	/// <param name="modele">Entit  cloner</param>
+	/// <returns>Adresse du clone, sinon NULL</returns>
+	CEntite* ClonerEntite(const CEntite& modele);
+
+	/// <summary>
+	/// Permet de dtruire l'entit spcifie, qu'elle soit alloue dans l'arne de ce tableau ou individuellement
+	/// <para>En mode concurrent, l'entit est seulement retire, et ne sera dtruite qu'une fois rcuprable (cf. Publier)</para>
+	/// </summary>
+	/// <param name="entite">Adresse de l'entit  dtruire</param>
+	/// <param name="immediatement">Indique si l'entit doit tre dtruite immdiatement, mme en mode concurrent</param>
+	void DetruireEntite(CEntite* entite, bool immediatement = false);
+
+	/// <summary>
+	/// Permet, en mode concurrent, de publier l'tat actuel de ce tableau  l'intention de ses lecteurs, puis de dtruire les entits retires qu'ils ne peuvent plus consulter
+	/// <para>Doit conclure toute modification du tableau des pointeurs, de l'tat de tri ou des entits</para>
+	/// </summary>
+	void Publier();
+
+	/// <summary>
+	/// Recherche dichotomique d'une borne, dans une plage d'entits trie selon la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="entite">Modle de l'entit dont on cherche la borne</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison selon laquelle la plage est trie</param>
+	/// <param name="borneSuperieure">Indique si l'on cherche la borne suprieure (premire entit strictement plus grande) plutt que la borne infrieure (premire entit plus grande ou gale)</param>
+	/// <param name="indiceDebut">Indice de la premire entit de la plage</param>
+	/// <param name="indiceFin">Indice suivant celui de la dernire entit de la plage</param>
+	/// <returns>Indice de la borne, compris entre indiceDebut et indiceFin</returns>
+	long ChercherBorne(const CEntite& entite, char modaliteComparaison, bool borneSuperieure, long indiceDebut, long indiceFin) const;
+
+	/// <summary>
+	/// Retourne le nombre de fils d'excution  utiliser pour trier le nombre spcifi d'entits de ce tableau selon les options de tri spcifies
+	/// </summary>
+	/// <param name="nombre">Nombre d'entits  trier</param>
+	/// <param name="optionsTri">Combinaison d'options de tri</param>
+	/// <returns>Nombre de fils d'excution (1 pour un tri en srie)</returns>
+	long NombreFilsTri(long nombre, char optionsTri) const;
+
+	/// <summary>
+	/// Permet de rfrencer l'entit qui vient d'tre insre  l'indice spcifi dans chaque index (de hachage ou de tri) actif
+	/// <para>Tout index qui ne peut rfrencer cette entit est abandonn, afin de ne jamais laisser un index incomplet</para>
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'entit  rfrencer</param>
+	void IndexerEntite(long indiceElement);
+
+	/// <summary>
+	/// Permet de retirer de chaque index (de hachage ou de tri) actif l'entit sur le point d'tre supprime  l'indice spcifi
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'entit (encore prsente)  retirer</param>
+	void DesindexerEntite(long indiceElement);
+
+	/// <summary>
+	/// Permet de supprimer tous les index de hachage de ce tableau
+	/// </summary>
+	void SupprimerIndexHachage();
+
+	/// <summary>
+	/// Permet de reconstruire chaque index de tri actif, aprs une permutation des entits de ce tableau
+	/// <para>Tout index qui ne peut tre reconstruit est abandonn</para>
+	/// </summary>
+	void ReconstruireIndexTri();
+
+	/// <summary>
+	/// Permet de reconstruire chaque index de hachage actif, aprs un remplacement des entits de ce tableau par des clones
+	/// <para>Tout index qui ne peut tre reconstruit est abandonn</para>
+	/// </summary>
+	void ReconstruireIndexHachage();
+
+	/// <summary>
+	/// Permet de supprimer tous les index de tri de ce tableau
+	/// </summary>
+	void SupprimerIndexTri();
+
+private:
+	/// <summary>
+	/// Membre contenant le nombre actuel d'entits  prendre en considration
+	/// </summary>
+	long m_Nombre;
+
+	/// <summary>
+	/// Membre contenant la taille actuelle du tableau des pointeurs
+	/// </summary>
+	long m_Taille;
+
+	/// <summary>
+	/// Membre contenant l'adresse de dbut du tableau des pointeurs vers chaque objet d'entit
+	/// </summary>
+	CEntite** m_Tableau;
+
+	/// <summary>
+	/// Membre contenant le tableau des pointeurs interne, dsign par m_Tableau tant que sa taille suffit (cf. TailleInterne)
+	/// </summary>
+	CEntite* m_TableauInterne[CTableau::TailleInterne];
+
+	/// <summary>
+	/// Membre contenant la taille en de de laquelle le tableau des pointeurs n'est jamais rduit (hormis par Compacter)
+	/// </summary>
+	long m_TailleReservee;
+
+	/// <summary>
+	/// Membre retenant la modalit de comparaison selon laquelle le prfixe tri du tableau d'entits est garanti tri, sinon NonTrie
+	/// </summary>
+	char m_TriActuel;
+
+	/// <summary>
+	/// Membre contenant la longueur du prfixe tri du tableau d'entits (gale au nombre d'entits si le tableau est entirement tri)
+	/// </summary>
+	long m_NombreTries;
+
+	/// <summary>
+	/// Membre indiquant si les ajouts en fin de tableau doivent prserver l'tat actuel de tri
+	/// </summary>
+	bool m_TriMaintenu;
+
+	/// <summary>
+	/// Membre contenant le nombre de fils d'excution des tris parallles (0 pour autant que de processeurs)
+	/// </summary>
+	long m_NombreFilsTri;
+
+	/// <summary>
+	/// Membre contenant le nombre d'entits en de duquel un tri parallle est ralis en srie
+	/// </summary>
+	long m_SeuilTriParallele;
+
+	/// <summary>
+	/// Membre pointant sur l'entit de rfrence
+	/// </summary>
+	CEntite* m_EntiteParDefaut;
+
+	/// <summary>
+	/// Membre contenant l'adresse de dbut du tableau des index de hachage (un emplacement par modalit de comparaison, NULL si non indexe), sinon NULL
+	/// </summary>
+	CIndexHachage** m_IndexHachage;
+
+	/// <summary>
+	/// Membre contenant l'adresse de dbut du tableau des index de tri (un emplacement par modalit de comparaison, NULL si non indexe), sinon NULL
+	/// </summary>
+	CIndexTri** m_IndexTri;
+
+	/// <summary>
+	/// Membre contenant l'adresse de l'arne d'allocation des entits clones, sinon NULL
+	/// </summary>
+	CArene* m_Arene;
+
+	/// <summary>
+	/// Membre contenant l'adresse du compteur des tableaux partageant le tableau des pointeurs, les entits et l'arne de ce tableau, sinon NULL (aucun partage)
+	/// <para>Le compteur n'est modifi que par des oprations atomiques, des copies d'un mme tableau pouvant tre cres ou dtaches par des fils d'excution diffrents</para>
+	/// </summary>
+	mutable volatile long* volatile m_CompteurPartage;
+
+	/// <summary>
+	/// Membre contenant l'adresse de la publication des tats de ce tableau  ses lecteurs, sinon NULL (mode concurrent dsactiv)
+	/// </summary>
+	CPublicationTableau* m_Publication;
+};
+
+/// <summary>
+/// Dfinit un lecteur d'un tableau en mode concurrent (cf. CTableau::ActiverConcurrence), destin  un seul fil d'excution : entre CommencerLecture et TerminerLecture, il consulte sans verrou un tat cohrent et immuable du tableau, quelles que soient les modifications apportes entre-temps par le rdacteur
+/// <para>Une lecture doit rester brve, les entits retires depuis son commencement ne pouvant tre dtruites avant sa fin</para>
+/// </summary>
+class CLecteurTableau
+{
+public:
+	/// <summary>
+	/// Constructeur spcifique : rserve un emplacement de lecteur du tableau spcifi
+	/// </summary>
+	/// <param name="tableau">Tableau en mode concurrent  consulter, qui doit le rester tant que ce lecteur existe</param>
+	CLecteurTableau(const CTableau& tableau);
+
+	/// <summary>
+	/// Destructeur : termine une ventuelle lecture en cours, et rend l'emplacement de lecteur
+	/// </summary>
+	~CLecteurTableau();
+
+	/// <summary>
+	/// Indique si ce lecteur a pu rserver un emplacement de lecteur (le tableau tant en mode concurrent, et le nombre maximal de lecteurs n'tant pas atteint)
+	/// </summary>
+	/// <returns>Vrai si ce lecteur peut commencer des lectures, sinon faux</returns>
+	bool EstValide() const;
+
+	/// <summary>
+	/// Permet de commencer une lecture, sur l'tat actuellement publi du tableau
+	/// </summary>
+	/// <returns>Vrai si la lecture est commence, sinon faux (lecteur invalide)</returns>
+	bool CommencerLecture();
+
+	/// <summary>
+	/// Permet de terminer la lecture en cours, les entits consultes ne devant plus l'tre ensuite
+	/// </summary>
+	void TerminerLecture();
+
+	/// <summary>
+	/// Accesseur du nombre d'entits de l'tat consult
+	/// </summary>
+	/// <returns>Nombre d'entits, sinon 0 hors lecture</returns>
+	long Nombre() const;
+
+	/// <summary>
+	/// Accesseur de l'entit spcifie de l'tat consult
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'entit<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Entit  cet indice valide, sinon l'entit par dfaut du tableau (y compris hors lecture)</returns>
+	const CEntite& Element(long indiceElement) const;
+
+	/// <summary>
+	/// Accesseur de l'entit spcifie de l'tat consult, dans son type rel
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'entit<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Entit  cet indice valide, sinon l'entit par dfaut du tableau</returns>
+	template <class T> const T& Element(long indiceElement) const
+	{
+		return (const T&)Element(indiceElement);
+	}
+
+	/// <summary>
+	/// Accesseur de la modalit de comparaison selon laquelle l'tat consult est entirement tri
+	/// </summary>
+	/// <returns>Modalit de comparaison, sinon CTableau::NonTrie</returns>
+	char TriActuel() const;
+
+	/// <summary>
+	/// Permet de rechercher dans l'tat consult une entit gale  celle spcifie, selon la modalit de comparaison spcifie : par dichotomie sur le prfixe tri selon cette modalit, puis par parcours des entits suivantes
+	/// </summary>
+	/// <param name="entiteARechercher">Entit  rechercher</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <returns>Indice de la premire entit gale, sinon -1</returns>
+	long Rechercher(const CEntite& entiteARechercher, char modaliteComparaison = (char)0) const;
+
+private:
+	/// <summary>
+	/// Constructeur par copie, interdit (chaque lecteur rserve son propre emplacement)
+	/// </summary>
+	/// <param name="source">Lecteur source</param>
+	CLecteurTableau(const CLecteurTableau& source);
+
+private:
+	/// <summary>
+	/// Membre contenant l'adresse de la publication des tats du tableau consult, sinon NULL
+	/// </summary>
+	CPublicationTableau* m_Publication;
+
+	/// <summary>
+	/// Membre contenant le numro de l'emplacement de lecteur rserv, sinon -1
+	/// </summary>
+	long m_Emplacement;
+
+	/// <summary>
+	/// Membre contenant l'adresse de l'tat consult par la lecture en cours, sinon NULL
+	/// </summary>
+	const CInstantaneTableau* m_Instantane;
+
+	/// <summary>
+	/// Membre contenant l'adresse de l'entit par dfaut du tableau consult, retourne pour tout indice invalide (cf. Element)
+	/// </summary>
+	const CEntite* m_EntiteParDefaut;
+};
+
+/// <summary>
+/// Dfinit un constructeur de tableau aliment par plusieurs producteurs (fils d'excution) simultans : chaque producteur valide et clone ses entits dans son propre tampon, sans verrou, puis Construire les ajoute au tableau en une seule fois (cf. CTableau::AdopterLot)
+/// <para>L'ordre d'ajout est dterministe (par numro de producteur, puis dans l'ordre de production), de mme que la rsolution des doublons selon les modalits d'unicit, qui retient la premire entit dans cet ordre</para>
+/// </summary>
+class CConstructeurTableau
+{
+public:
+	/// <summary>
+	/// Constructeur spcifique
+	/// </summary>
+	/// <param name="entiteParDefaut">Entit par dfaut des tableaux  construire, servant  valider les entits produites</param>
+	/// <param name="nombreProducteurs">Nombre de producteurs<para>Au moins gal  1</para></param>
+	CConstructeurTableau(const CEntite& entiteParDefaut, long nombreProducteurs);
+
+	/// <summary>
+	/// Destructeur : dtruit les entits produites qui n'ont pas t ajoutes  un tableau
+	/// </summary>
+	~CConstructeurTableau();
+
+	/// <summary>
+	/// Accesseur du nombre de producteurs
+	/// </summary>
+	/// <returns>Nombre de producteurs, sinon 0 (faute de mmoire  la construction)</returns>
+	long NombreProducteurs() const;
+
+	/// <summary>
+	/// Permet au producteur spcifi d'ajouter  son tampon une nouvelle entit,  partir du modle spcifi d'entit
+	/// <para>Chaque producteur ne doit alimenter que son propre tampon, et un seul fil d'excution  la fois peut le faire</para>
+	/// </summary>
+	/// <param name="producteur">Numro du producteur<para>Compris entre 0 et le nombre de producteurs - 1</para></param>
+	/// <param name="entiteAAjouter">Modle de l'entit  ajouter</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux (producteur ou entit invalide, ou faute de mmoire)</returns>
+	bool Ajouter(long producteur, const CEntite& entiteAAjouter);
+
+	/// <summary>
+	/// Permet au producteur spcifi d'ajouter  son tampon une nouvelle entit,  partir de l'entit temporaire spcifie, dont les ressources sont transfres (cf. ClonerParDeplacement)
+	/// </summary>
+	/// <param name="producteur">Numro du producteur<para>Compris entre 0 et le nombre de producteurs - 1</para></param>
+	/// <param name="entiteAAjouter">Entit temporaire  ajouter</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Ajouter(long producteur, CEntite&& entiteAAjouter);
+
+	/// <summary>
+	/// Permet au producteur spcifi d'ajouter  son tampon l'entit spcifie, cre dynamiquement, sans la cloner : le constructeur en devient propritaire
+	/// <para>En cas d'chec, l'entit est dtruite</para>
+	/// </summary>
+	/// <param name="producteur">Numro du producteur<para>Compris entre 0 et le nombre de producteurs - 1</para></param>
+	/// <param name="entiteAAdopter">Adresse de l'entit cre dynamiquement</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Adopter(long producteur, CEntite* entiteAAdopter);
+
+	/// <summary>
+	/// Accesseur du nombre d'entits produites par le producteur spcifi, en attente d'ajout
+	/// </summary>
+	/// <param name="producteur">Numro du producteur</param>
+	/// <returns>Nombre d'entits, sinon -1 (producteur invalide)</returns>
+	long Nombre(long producteur) const;
+
+	/// <summary>
+	/// Permet d'ajouter en fin du tableau spcifi, en une seule fois, les entits produites, par numro de producteur puis dans l'ordre de production, les tampons tant ensuite vids
+	/// <para>Doit tre appele une fois tous les producteurs arrts ; les entits rejetes (doublons selon les modalits d'unicit du tableau) sont dtruites</para>
+	/// </summary>
+	/// <param name="tableau">Tableau  alimenter, dont l'entit par dfaut est du mme type que celle de ce constructeur</param>
+	/// <param name="rejetees">[RESULTAT] Adresse d'un tableau d'autant d'indicateurs que d'entits produites, dont chacun indique si l'entit correspondante, dans l'ordre d'ajout, a t rejete, sinon NULL</param>
+	/// <returns>Nombre d'entits ajoutes, sinon -1 (faute de mmoire, les tampons tant alors conservs)</returns>
+	long Construire(CTableau& tableau, bool* rejetees = NULL);
+
+	/// <summary>
+	/// Permet de dtruire toutes les entits produites en attente d'ajout
+	/// </summary>
+	void Vider();
+
+private:
+	/// <summary>
+	/// Taille d'une ligne de cache, en octets : taille et alignement des tampons des producteurs
+	/// </summary>
+	static const long TailleLigneCache = 64;
+
+	/// <summary>
+	/// Dfinit le tampon d'un producteur, occupant sa propre ligne de cache afin que les producteurs ne se ralentissent pas mutuellement
+	/// </summary>
+	class CTamponProducteur
+	{
+	public:
+		/// <summary>
+		/// Membre contenant l'adresse du tableau des adresses des entits produites, sinon NULL
+		/// </summary>
+		CEntite** m_Entites;
+
+		/// <summary>
+		/// Membre contenant le nombre d'entits produites
+		/// </summary>
+		long m_Nombre;
+
+		/// <summary>
+		/// Membre contenant la taille du tableau des adresses des entits produites
+		/// </summary>
+		long m_Taille;
+
+		/// <summary>
+		/// Membre de remplissage jusqu' la fin de la ligne de cache
+		/// </summary>
+		char m_Remplissage[CConstructeurTableau::TailleLigneCache - sizeof(CEntite**) - 2 * sizeof(long)];
+	};
+
+	/// <summary>
+	/// Constructeur par copie, interdit
+	/// </summary>
+	/// <param name="source">Constructeur source</param>
+	CConstructeurTableau(const CConstructeurTableau& source);
+
+	/// <summary>
+	/// Permet de placer dans le tampon du producteur spcifi l'entit spcifie, dont le constructeur devient propritaire, aprs l'avoir valide
+	/// <para>En cas d'chec, l'entit est dtruite</para>
+	/// </summary>
+	/// <param name="producteur">Numro du producteur</param>
+	/// <param name="entite">Adresse de l'entit cre dynamiquement, sinon NULL (chec)</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool PlacerEntite(long producteur, CEntite* entite);
+
+private:
+	/// <summary>
+	/// Membre contenant l'adresse de l'entit par dfaut, servant  valider les entits produites
+	/// </summary>
+	CEntite* m_EntiteParDefaut;
+
+	/// <summary>
+	/// Membre contenant le nombre de producteurs
+	/// </summary>
+	long m_NombreProducteurs;
+
+	/// <summary>
+	/// Membre contenant l'adresse du tableau des tampons des producteurs
+	/// </summary>
+	CTamponProducteur* m_Tampons;
+};
+
+/// <summary>
+/// Dfinit une vue sur un tableau : une slection d'entits du tableau (cf. Filtrer), qui ne retient que leurs adresses, dans un ordre qui lui est propre (cf. Trier)
+/// <para>Une vue ne cote ainsi qu'un pointeur par entit retenue, sans clonage ni revalidation ; elle doit tre reconstruite aprs toute modification du tableau, qui doit lui survivre</para>
+/// </summary>
+class CVueTableau
+{
+public:
+	/// <summary>
+	/// Constructeur spcifique : vue vide sur le tableau spcifi
+	/// </summary>
+	/// <param name="tableau">Tableau sur lequel porte la vue</param>
+	CVueTableau(const CTableau& tableau);
+
+	/// <summary>
+	/// Destructeur
+	/// </summary>
+	~CVueTableau();
+
+	/// <summary>
+	/// Permet de (re)construire la vue  partir des entits du tableau qui vrifient le prdicat spcifi, dans l'ordre du tableau
+	/// <para>La vue reprend l'tat de tri du tableau s'il est entirement tri ; la mmoire dj alloue par la vue est rutilise</para>
+	/// </summary>
+	/// <param name="predicat">Fonction dcidant si une entit est retenue, sinon NULL pour retenir toutes les entits</param>
+	/// <param name="contexte">Contexte transmis au prdicat, sinon NULL</param>
+	/// <returns>Vrai si la vue a pu tre construite, sinon faux (faute de mmoire, la vue tant alors vide)</returns>
+	bool Filtrer(CTableau::PredicatEntite predicat = NULL, const void* contexte = NULL);
+
+	/// <summary>
+	/// Permet de trier les entits de la vue selon la modalit de comparaison spcifie, sans modifier le tableau (cf. CTableau::TrierAdresses)
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::Trier)</param>
+	/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+	bool Trier(char modaliteComparaison = (char)0, char optionsTri = (char)0);
+
+	/// <summary>
+	/// Permet de parcourir la vue par groupes d'entits gales selon la modalit de comparaison spcifie, aprs un tri de la vue selon celle-ci, sans modifier le tableau (cf. CTableau::Grouper)
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison dfinissant l'galit des entits d'un groupe</param>
+	/// <param name="traitement">Fonction appele pour chaque groupe, dans l'ordre du tri, sinon NULL pour seulement compter les groupes</param>
+	/// <param name="contexteTraitement">Contexte transmis tel quel au traitement  chaque appel</param>
+	/// <param name="projection">Fonction projetant chaque entit sur la valeur numrique  cumuler, sinon NULL</param>
+	/// <param name="contexteProjection">Contexte transmis tel quel  la projection  chaque appel</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (cf. CTableau::Trier)</param>
+	/// <returns>Nombre de groupes soumis au traitement, sinon -1 (modalit invalide ou chec du tri)</returns>
+	long Grouper(char modaliteComparaison, CTableau::TraitementGroupe traitement, void* contexteTraitement = NULL, CTableau::ProjectionEntite projection = NULL, const void* contexteProjection = NULL, char optionsTri = (char)0);
+
+	/// <summary>
+	/// Accesseur du nombre d'entits de la vue
+	/// </summary>
+	/// <returns>Nombre d'entits retenues</returns>
+	long Nombre() const;
+
+	/// <summary>
+	/// Accesseur de l'entit spcifie de la vue
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'entit dans la vue<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Entit  cet indice</returns>
+	const CEntite& Element(long indiceElement) const;
+
+	/// <summary>
+	/// Accesseur de l'entit spcifie de la vue, dans son type rel
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'entit dans la vue<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Entit  cet indice</returns>
+	template <class T> const T& Element(long indiceElement) const
+	{
+		return (const T&)Element(indiceElement);
+	}
+
+	/// <summary>
+	/// Accesseur de la modalit de comparaison selon laquelle la vue est trie
+	/// </summary>
+	/// <returns>Modalit de comparaison, sinon CTableau::NonTrie</returns>
+	char TriActuel() const;
+
+	/// <summary>
+	/// Permet de rechercher dans la vue une entit gale  celle spcifie, selon la modalit de comparaison spcifie : par dichotomie si la vue est trie selon cette modalit, sinon par parcours
+	/// </summary>
+	/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <returns>Indice dans la vue de la premire occurrence d'entit gale, sinon -1</returns>
+	long Rechercher(const CEntite& entiteARechercher, char modaliteComparaison = (char)0) const;
+
+	/// <summary>
+	/// Permet de vider la vue, en rendant la mmoire qu'elle occupe
+	/// </summary>
+	void Vider();
+
+private:
+	/// <summary>
+	/// Constructeur par copie, interdit
+	/// </summary>
+	/// <param name="source">Vue source</param>
+	CVueTableau(const CVueTableau& source);
+
+private:
+	/// <summary>
+	/// Membre contenant l'adresse du tableau sur lequel porte la vue
+	/// </summary>
+	const CTableau* m_Tableau;
+
+	/// <summary>
+	/// Membre contenant l'adresse du tableau des adresses des entits retenues, sinon NULL
+	/// </summary>
+	CEntite** m_Entites;
+
+	/// <summary>
+	/// Membre contenant le nombre d'entits retenues
+	/// </summary>
+	long m_Nombre;
+
+	/// <summary>
+	/// Membre contenant la taille du tableau des adresses des entits retenues
+	/// </summary>
+	long m_Taille;
+
+	/// <summary>
+	/// Membre contenant la modalit de comparaison selon laquelle la vue est trie, sinon CTableau::NonTrie
+	/// </summary>
+	char m_TriActuel;
 };
 
 #endif//TABLEAU_H
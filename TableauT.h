@@ -0,0 +1,422 @@
+#ifndef TABLEAUT_H
+#define TABLEAUT_H
+
+#include <new>
+#include "Tableau.h"
+#include "Tri.h"
+
+/// <summary>
+/// Dfinit un tableau d'entits d'un mme type T (driv de CEntite), stockes par valeur de manire contigu
+/// <para>Contrairement  CTableau, aucune entit n'est alloue individuellement : les parcours et les tris de grands tableaux homognes en sont d'autant plus rapides</para>
+/// <para>Les entits sont dplaces en mmoire par simple copie de leurs octets (rallocation, insertion, suppression, tri) : le type T ne doit donc retenir aucune adresse pointant sur lui-mme</para>
+/// </summary>
+template <class T> class CTableauT
+{
+public:
+	/// <summary>
+	/// Constructeur spcifique
+	/// </summary>
+	/// <param name="entiteParDefaut">Modle d'entit par dfaut (c'est ce qui dtermine les rgles de validit et d'unicit des lments de ce tableau)<para>Il peut tre d'un type driv de T, tel qu'une rgle (cf. CRegleSurChaine), puisqu'il est clon</para></param>
+	CTableauT(const CEntite& entiteParDefaut = T())
+		:m_Nombre(0), m_Taille(0), m_Elements(NULL), m_TriActuel(CTableau::NonTrie), m_EntiteParDefaut(entiteParDefaut.Cloner())
+	{
+	}
+
+	/// <summary>
+	/// Constructeur par copie
+	/// </summary>
+	/// <param name="source">Tableau source de cette copie</param>
+	CTableauT(const CTableauT<T>& source)
+		:m_Nombre(0), m_Taille(0), m_Elements(NULL), m_TriActuel(CTableau::NonTrie), m_EntiteParDefaut(source.m_EntiteParDefaut->Cloner())
+	{
+		// Les entits de la source tant dj valides et uniques, elles sont directement recopies
+		if (!Redimensionner(source.m_Nombre)) return;
+		for (long indice = 0; indice < source.m_Nombre; indice++)
+		{
+			new (m_Elements + indice) T(source.m_Elements[indice]);
+		}
+		m_Nombre = source.m_Nombre;
+		m_TriActuel = source.m_TriActuel;
+	}
+
+	/// <summary>
+	/// Destructeur
+	/// </summary>
+	~CTableauT()
+	{
+		Vider();
+		Redimensionner(0);
+		delete m_EntiteParDefaut;
+	}
+
+	/// <summary>
+	/// Permet de supprimer toutes les entits du tableau (la mmoire de stockage est conserve)
+	/// </summary>
+	void Vider()
+	{
+		for (long indice = 0; indice < m_Nombre; indice++) m_Elements[indice].~T();
+		m_Nombre = 0;
+		m_TriActuel = CTableau::NonTrie;
+	}
+
+	/// <summary>
+	/// Permet d'ajouter une copie de l'entit spcifie en fin de tableau
+	/// </summary>
+	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+	/// <returns>Vrai si l'ajout a pu se faire, sinon faux</returns>
+	bool Ajouter(const T& entiteAAjouter)
+	{
+		return Inserer(m_Nombre, entiteAAjouter);
+	}
+
+	/// <summary>
+	/// Permet d'insrer une copie de l'entit spcifie  la position spcifie du tableau
+	/// </summary>
+	/// <param name="indiceInsertion">Indice d'insertion<para>Compris entre 0 et le nombre d'entits</para></param>
+	/// <param name="entiteAAjouter">Modle de l'entit  ajouter dans le tableau</param>
+	/// <returns>Vrai si l'insertion a pu se faire, sinon faux</returns>
+	bool Inserer(long indiceInsertion, const T& entiteAAjouter)
+	{
+		// Vrifier la validit des paramtres
+		if ((indiceInsertion < 0) || (indiceInsertion > m_Nombre)) return false;
+		if (!entiteAAjouter.EstValide(m_EntiteParDefaut)) return false;
+		// Vrifier la ou les unicits  tester
+		for (char modaliteComparaison = 0, nombreComparaisons = m_EntiteParDefaut->NombreComparaisons(); modaliteComparaison < nombreComparaisons; modaliteComparaison++)
+		{
+			if (m_EntiteParDefaut->EstComparaisonPourUnicite(modaliteComparaison) && (Rechercher(entiteAAjouter, modaliteComparaison) >= 0)) return false;
+		}
+		// Ajustement si ncessaire de la taille du stockage (croissance gomtrique)
+		if ((m_Nombre == m_Taille) && !Redimensionner((m_Taille < CTableau::TailleMinimale) ? CTableau::TailleMinimale : (m_Taille * 2))) return false;
+		// Dcalage des entits, d'une position vers la position suivante, et ce,  partir de la position d'insertion
+		if (indiceInsertion < m_Nombre)
+		{
+			memmove((void*)(m_Elements + (indiceInsertion + 1)), (const void*)(m_Elements + indiceInsertion), (m_Nombre - indiceInsertion) * sizeof(T));
+		}
+		// Copie de l'entit  ajouter directement dans son emplacement
+		new (m_Elements + indiceInsertion) T(entiteAAjouter);
+		m_Nombre++;
+		// Seul un ajout en fin de tableau tri, d'une entit non infrieure  la dernire, prserve l'tat actuel de tri
+		if ((m_TriActuel != CTableau::NonTrie) && ((indiceInsertion != (m_Nombre - 1)) || ((indiceInsertion > 0) && (m_Elements[indiceInsertion - 1].Comparer(m_Elements[indiceInsertion], m_TriActuel) > 0))))
+		{
+			m_TriActuel = CTableau::NonTrie;
+		}
+		// Indication de russite de l'insertion
+		return true;
+	}
+
+	/// <summary>
+	/// Permet de supprimer l'entit spcifie du tableau
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  supprimer<para>Compris entre 0 et le nombre d'entits - 1</para></param>
+	/// <returns>Vrai si la suppression a pu se faire, sinon faux</returns>
+	bool Supprimer(long indiceElement)
+	{
+		// Vrifier la validit des paramtres
+		if ((indiceElement < 0) || (indiceElement >= m_Nombre)) return false;
+		m_Elements[indiceElement].~T();
+		// Dcalage des entits, d'une position vers la position prcdente, et ce,  partir de la position suivant celle de suppression
+		if (indiceElement < (m_Nombre - 1))
+		{
+			memmove((void*)(m_Elements + indiceElement), (const void*)(m_Elements + (indiceElement + 1)), ((m_Nombre - 1) - indiceElement) * sizeof(T));
+		}
+		// La suppression d'une entit laisse tri un tableau tri
+		m_Nombre--;
+		if (m_Nombre == 0) m_TriActuel = CTableau::NonTrie;
+		return true;
+	}
+
+	/// <summary>
+	/// Permet de s'assurer que le stockage peut contenir au moins le nombre spcifi d'entits, sans nouvelle rallocation
+	/// </summary>
+	/// <param name="nombre">Nombre d'entits  pouvoir contenir</param>
+	/// <returns>Vrai si la rservation a pu se faire, sinon faux</returns>
+	bool Reserver(long nombre)
+	{
+		if (nombre < 0) return false;
+		return (nombre <= m_Taille) || Redimensionner(nombre);
+	}
+
+	/// <summary>
+	/// Permet de trier les entits selon la modalit de comparaison spcifie
+	/// <para>Ce sont les adresses des entits qui sont tries, les entits n'tant ensuite dplaces qu'une seule fois chacune, vers leur position dfinitive</para>
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser lors du tri des entits</param>
+	/// <param name="optionsTri">Combinaison d'options de tri (CTableau::TriStable, CTableau::TriParallele)</param>
+	/// <returns>Vrai si le tri est ralis, sinon faux</returns>
+	bool Trier(char modaliteComparaison = (char)0, char optionsTri = (char)0)
+	{
+		if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return false;
+		if (modaliteComparaison == m_TriActuel) return true;
+		if (m_Nombre >= 2)
+		{
+			bool stable = ((optionsTri & CTableau::TriStable) != 0);
+			long nombreFils = 1;
+			if (((optionsTri & CTableau::TriParallele) != 0) && (m_Nombre >= CTableau::SeuilTriParalleleParDefaut))
+			{
+				SYSTEM_INFO informationsSysteme;
+				GetSystemInfo(&informationsSysteme);
+				nombreFils = (informationsSysteme.dwNumberOfProcessors > MAXIMUM_WAIT_OBJECTS) ? MAXIMUM_WAIT_OBJECTS : (long)informationsSysteme.dwNumberOfProcessors;
+			}
+			// Les adresses  trier sont suivies du tampon ncessaire au tri stable ou parallle
+			T** adresses = (T**)malloc(((stable || (nombreFils >= 2)) ? (2 * m_Nombre) : m_Nombre) * sizeof(T*));
+			if (adresses == NULL) return false;
+			for (long indice = 0; indice < m_Nombre; indice++) adresses[indice] = m_Elements + indice;
+			// Tri par la fonction de comparaison directe du type d'entit s'il en propose une (ce qui vite l'appel virtuel et la slection de la modalit  chaque comparaison)
+			CEntite::ComparateurEntites comparateur = m_EntiteParDefaut->ObtenirComparateur(modaliteComparaison);
+			if (comparateur != NULL)
+			{
+				TrierAdresses(adresses, CComparateurDirect(comparateur), stable, nombreFils);
+			}
+			else
+			{
+				TrierAdresses(adresses, CComparateurVirtuel(modaliteComparaison), stable, nombreFils);
+			}
+			Permuter(adresses);
+			free(adresses);
+		}
+		// Indication de russite du tri
+		m_TriActuel = modaliteComparaison;
+		return true;
+	}
+
+	/// <summary>
+	/// Permet de rechercher la premire entit gale  l'entit spcifie, selon la modalit de comparaison spcifie
+	/// <para>La recherche est dichotomique si le tableau est tri selon cette modalit, sinon squentielle</para>
+	/// </summary>
+	/// <param name="entiteARechercher">Modle de l'entit  rechercher</param>
+	/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+	/// <param name="indiceDebut">Indice  partir duquel rechercher</param>
+	/// <returns>Indice de l'entit trouve, sinon -1</returns>
+	long Rechercher(const CEntite& entiteARechercher, char modaliteComparaison = (char)0, long indiceDebut = 0) const
+	{
+		// Vrifier la validit des paramtres
+		if ((modaliteComparaison < 0) || (modaliteComparaison >= m_EntiteParDefaut->NombreComparaisons())) return -1;
+		if (indiceDebut < 0) indiceDebut = 0;
+		if (modaliteComparaison == m_TriActuel)
+		{
+			// Recherche de la borne infrieure, qui est la premire occurrence si elle existe
+			long indiceFin = m_Nombre;
+			while (indiceDebut < indiceFin)
+			{
+				long indiceMilieu = indiceDebut + (indiceFin - indiceDebut) / 2;
+				if (entiteARechercher.Comparer(m_Elements[indiceMilieu], modaliteComparaison) > 0)
+				{
+					indiceDebut = indiceMilieu + 1;
+				}
+				else
+				{
+					indiceFin = indiceMilieu;
+				}
+			}
+			return ((indiceDebut < m_Nombre) && (entiteARechercher.Comparer(m_Elements[indiceDebut], modaliteComparaison) == 0)) ? indiceDebut : -1;
+		}
+		for (long indice = indiceDebut; indice < m_Nombre; indice++)
+		{
+			if (entiteARechercher.Comparer(m_Elements[indice], modaliteComparaison) == 0) return indice;
+		}
+		return -1;
+	}
+
+	/// <summary>
+	/// Accesseur du nombre d'entits de ce tableau
+	/// </summary>
+	/// <returns>Nombre d'entits</returns>
+	long Nombre() const
+	{
+		return m_Nombre;
+	}
+
+	/// <summary>
+	/// Accesseur de l'entit spcifie par son indice
+	/// </summary>
+	/// <param name="indiceElement">Indice de l'lment  rcuprer</param>
+	/// <returns>Rfrence sur l'entit</returns>
+	const T& Element(long indiceElement) const
+	{
+		return m_Elements[indiceElement];
+	}
+
+	/// <summary>
+	/// Accesseur indiquant comment le tableau est actuellement tri
+	/// </summary>
+	/// <returns>Modalit de comparaison selon laquelle le tableau est tri, sinon CTableau::NonTrie</returns>
+	char TriActuel() const
+	{
+		return m_TriActuel;
+	}
+
+	/// <summary>
+	/// Indique si le tableau est actuellement tri selon la modalit de comparaison spcifie
+	/// </summary>
+	/// <param name="modaliteComparaison">Modalit de comparaison  tester</param>
+	/// <returns>Vrai si le tableau est tri selon cette modalit, sinon faux</returns>
+	bool EstTrie(char modaliteComparaison) const
+	{
+		return (modaliteComparaison >= 0) && (modaliteComparaison == m_TriActuel);
+	}
+
+private:
+	/// <summary>
+	/// Dfinit un comparateur d'adresses d'entits, par leur mthode virtuelle Comparer
+	/// </summary>
+	class CComparateurVirtuel
+	{
+	public:
+		/// <summary>
+		/// Constructeur spcifique
+		/// </summary>
+		/// <param name="modaliteComparaison">Modalit de comparaison  utiliser</param>
+		CComparateurVirtuel(char modaliteComparaison)
+			:m_ModaliteComparaison(modaliteComparaison)
+		{
+		}
+
+		/// <summary>
+		/// Compare les entits d'adresses spcifies
+		/// </summary>
+		/// <param name="entite">Adresse de l'entit</param>
+		/// <param name="autreEntite">Adresse de l'autre entit</param>
+		/// <returns>Valeur ngative si l'entit prcde l'autre entit, positive si elle la suit, sinon 0</returns>
+		int operator()(const T* entite, const T* autreEntite) const
+		{
+			return entite->Comparer(*autreEntite, m_ModaliteComparaison);
+		}
+
+	private:
+		/// <summary>
+		/// Membre contenant la modalit de comparaison
+		/// </summary>
+		char m_ModaliteComparaison;
+	};
+
+	/// <summary>
+	/// Dfinit un comparateur d'adresses d'entits, par la fonction de comparaison directe du type d'entit
+	/// </summary>
+	class CComparateurDirect
+	{
+	public:
+		/// <summary>
+		/// Constructeur spcifique
+		/// </summary>
+		/// <param name="comparateur">Fonction de comparaison directe</param>
+		CComparateurDirect(CEntite::ComparateurEntites comparateur)
+			:m_Comparateur(comparateur)
+		{
+		}
+
+		/// <summary>
+		/// Compare les entits d'adresses spcifies
+		/// </summary>
+		/// <param name="entite">Adresse de l'entit</param>
+		/// <param name="autreEntite">Adresse de l'autre entit</param>
+		/// <returns>Valeur ngative si l'entit prcde l'autre entit, positive si elle la suit, sinon 0</returns>
+		int operator()(const T* entite, const T* autreEntite) const
+		{
+			return m_Comparateur(*entite, *autreEntite);
+		}
+
+	private:
+		/// <summary>
+		/// Membre contenant la fonction de comparaison directe
+		/// </summary>
+		CEntite::ComparateurEntites m_Comparateur;
+	};
+
+	/// <summary>
+	/// Permet de trier les adresses des entits au moyen du comparateur spcifi
+	/// </summary>
+	/// <param name="adresses">Adresses des entits, suivies si ncessaire d'un tampon de mme taille</param>
+	/// <param name="comparateur">Objet comparateur d'adresses d'entits</param>
+	/// <param name="stable">Indique si le tri doit tre stable</param>
+	/// <param name="nombreFils">Nombre de fils d'excution (1 pour un tri en srie)</param>
+	template <class C> void TrierAdresses(T** adresses, const C& comparateur, bool stable, long nombreFils)
+	{
+		if ((nombreFils >= 2) && TrierEnParallele(adresses, m_Nombre, comparateur, stable, nombreFils, adresses + m_Nombre)) return;
+		if (stable)
+		{
+			TrierParFusion(adresses, m_Nombre, comparateur, adresses + m_Nombre);
+		}
+		else
+		{
+			TrierIntrospectif(adresses, m_Nombre, comparateur);
+		}
+	}
+
+	/// <summary>
+	/// Permet de modifier la taille effective du stockage des entits
+	/// </summary>
+	/// <param name="nouvelleTaille">Nouvelle taille du stockage<para>Au moins gale au nombre actuel d'entits</para></param>
+	/// <returns>Vrai si le redimensionnement a pu se faire, sinon faux</returns>
+	bool Redimensionner(long nouvelleTaille)
+	{
+		if (nouvelleTaille < m_Nombre) return false;
+		if (nouvelleTaille == 0)
+		{
+			if (m_Elements != NULL) free(m_Elements);
+			m_Elements = NULL;
+			m_Taille = 0;
+			return true;
+		}
+		void* nouvelleAdresse = (m_Elements == NULL) ? malloc(nouvelleTaille * sizeof(T)) : realloc((void*)m_Elements, nouvelleTaille * sizeof(T));
+		if (nouvelleAdresse == NULL) return false;
+		m_Elements = (T*)nouvelleAdresse;
+		m_Taille = nouvelleTaille;
+		return true;
+	}
+
+	/// <summary>
+	/// Permet de dplacer les entits selon la permutation spcifie, en suivant ses cycles afin que chaque entit ne soit dplace qu'une seule fois
+	/// </summary>
+	/// <param name="adresses">Adresses tries : adresses[i] est l'adresse actuelle de l'entit devant occuper la position i<para>Ce tableau est modifi</para></param>
+	void Permuter(T** adresses)
+	{
+		unsigned char temporaire[sizeof(T)];
+		for (long indice = 0; indice < m_Nombre; indice++)
+		{
+			if (adresses[indice] == (m_Elements + indice)) continue;
+			// L'entit de la position de dpart du cycle est mise de ct, sa position tant la premire  remplir
+			memcpy(temporaire, (const void*)(m_Elements + indice), sizeof(T));
+			long indiceDestination = indice;
+			for (;;)
+			{
+				long indiceSource = (long)(adresses[indiceDestination] - m_Elements);
+				adresses[indiceDestination] = m_Elements + indiceDestination;
+				if (indiceSource == indice)
+				{
+					memcpy((void*)(m_Elements + indiceDestination), temporaire, sizeof(T));
+					break;
+				}
+				memcpy((void*)(m_Elements + indiceDestination), (const void*)(m_Elements + indiceSource), sizeof(T));
+				indiceDestination = indiceSource;
+			}
+		}
+	}
+
+private:
+	/// <summary>
+	/// Membre contenant le nombre d'entits
+	/// </summary>
+	long m_Nombre;
+
+	/// <summary>
+	/// Membre contenant le nombre d'entits que peut contenir le stockage
+	/// </summary>
+	long m_Taille;
+
+	/// <summary>
+	/// Membre contenant l'adresse du stockage contigu des entits
+	/// </summary>
+	T* m_Elements;
+
+	/// <summary>
+	/// Membre retenant l'tat actuel garanti du tableau d'entits
+	/// </summary>
+	char m_TriActuel;
+
+	/// <summary>
+	/// Membre contenant l'adresse du modle d'entit par dfaut (clone de celui spcifi  la construction)
+	/// </summary>
+	CEntite* m_EntiteParDefaut;
+};
+
+#endif//TABLEAUT_H
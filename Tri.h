@@ -0,0 +1,487 @@
+#ifndef TRI_H
+#define TRI_H
+
+#include <Windows.h>
+
+/// <summary>
+/// Nombre d'lments en de duquel une plage est trie par insertion plutt que par partition
+/// </summary>
+const long SeuilTriParInsertion = 16;
+
+/// <summary>
+/// Permet d'changer les deux lments spcifis
+/// </summary>
+/// <param name="element">Premier lment</param>
+/// <param name="autreElement">Second lment</param>
+template <class T> inline void EchangerElements(T& element, T& autreElement)
+{
+	T temporaire = element;
+	element = autreElement;
+	autreElement = temporaire;
+}
+
+/// <summary>
+/// Permet de trier par insertion (tri stable, efficace sur de petites plages ou des plages presque tries) les lments spcifis
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage  trier</param>
+/// <param name="nombre">Nombre d'lments de la plage  trier</param>
+/// <param name="comparateur">Objet comparateur : comparateur(a, b) retourne une valeur ngative si a prcde b, positive si b prcde a, sinon 0</param>
+template <class T, class C> void TrierParInsertion(T* elements, long nombre, const C& comparateur)
+{
+	for (long indice = 1; indice < nombre; indice++)
+	{
+		if (comparateur(elements[indice], elements[indice - 1]) >= 0) continue;
+		T element = elements[indice];
+		long position = indice;
+		do
+		{
+			elements[position] = elements[position - 1];
+			position--;
+		} while ((position > 0) && (comparateur(element, elements[position - 1]) < 0));
+		elements[position] = element;
+	}
+}
+
+/// <summary>
+/// Permet de faire descendre l'lment de l'indice spcifi jusqu' sa place dans un tas (le plus grand lment tant  la racine)
+/// </summary>
+/// <param name="elements">Adresse du premier lment du tas</param>
+/// <param name="indice">Indice de l'lment  faire descendre</param>
+/// <param name="nombre">Nombre d'lments du tas</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+template <class T, class C> void TamiserTas(T* elements, long indice, long nombre, const C& comparateur)
+{
+	T element = elements[indice];
+	while (true)
+	{
+		long enfant = 2 * indice + 1;
+		if (enfant >= nombre) break;
+		if (((enfant + 1) < nombre) && (comparateur(elements[enfant], elements[enfant + 1]) < 0)) enfant++;
+		if (comparateur(element, elements[enfant]) >= 0) break;
+		elements[indice] = elements[enfant];
+		indice = enfant;
+	}
+	elements[indice] = element;
+}
+
+/// <summary>
+/// Permet de trier par tas (tri non stable, en O(n log n) dans tous les cas) les lments spcifis
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage  trier</param>
+/// <param name="nombre">Nombre d'lments de la plage  trier</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+template <class T, class C> void TrierParTas(T* elements, long nombre, const C& comparateur)
+{
+	for (long indice = nombre / 2 - 1; indice >= 0; indice--) TamiserTas(elements, indice, nombre, comparateur);
+	for (long dernier = nombre - 1; dernier > 0; dernier--)
+	{
+		EchangerElements(elements[0], elements[dernier]);
+		TamiserTas(elements, 0, dernier, comparateur);
+	}
+}
+
+/// <summary>
+/// Permet de trier de manire introspective (tri rapide  mdiane de trois, basculant en tri par tas au-del d'une profondeur de rcursivit de 2 log n, et achev par insertion sur les petites plages) les lments spcifis
+/// <para>Tri non stable, en O(n log n) dans tous les cas ; les lments gaux au pivot sont rpartis des deux cts, ce qui prserve l'quilibre en prsence de nombreux doublons</para>
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage  trier</param>
+/// <param name="nombre">Nombre d'lments de la plage  trier</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+/// <param name="profondeur">Profondeur de rcursivit restante avant de basculer en tri par tas (ngative pour la calculer d'aprs le nombre d'lments)</param>
+template <class T, class C> void TrierIntrospectif(T* elements, long nombre, const C& comparateur, int profondeur = -1)
+{
+	if (profondeur < 0)
+	{
+		profondeur = 0;
+		for (long reste = nombre; reste > 1; reste >>= 1) profondeur += 2;
+	}
+	while (nombre > SeuilTriParInsertion)
+	{
+		if (profondeur == 0)
+		{
+			TrierParTas(elements, nombre, comparateur);
+			return;
+		}
+		profondeur--;
+		// Mdiane de trois : aprs ces changes, premier <= milieu <= dernier, ce qui borne les deux parcours de la partition
+		long milieu = nombre / 2;
+		if (comparateur(elements[milieu], elements[0]) < 0) EchangerElements(elements[milieu], elements[0]);
+		if (comparateur(elements[nombre - 1], elements[milieu]) < 0)
+		{
+			EchangerElements(elements[nombre - 1], elements[milieu]);
+			if (comparateur(elements[milieu], elements[0]) < 0) EchangerElements(elements[milieu], elements[0]);
+		}
+		// Le pivot est plac en tte, le temps de la partition
+		EchangerElements(elements[0], elements[milieu]);
+		T pivot = elements[0];
+		long gauche = 0;
+		long droite = nombre;
+		while (true)
+		{
+			do gauche++; while (comparateur(elements[gauche], pivot) < 0);
+			do droite--; while (comparateur(pivot, elements[droite]) < 0);
+			if (gauche >= droite) break;
+			EchangerElements(elements[gauche], elements[droite]);
+		}
+		EchangerElements(elements[0], elements[droite]);
+		// Rcursivit sur la plus petite des deux plages, itration sur la plus grande (la pile reste en O(log n))
+		long nombreGauche = droite;
+		long nombreDroite = nombre - (droite + 1);
+		if (nombreGauche < nombreDroite)
+		{
+			TrierIntrospectif(elements, nombreGauche, comparateur, profondeur);
+			elements += droite + 1;
+			nombre = nombreDroite;
+		}
+		else
+		{
+			TrierIntrospectif(elements + (droite + 1), nombreDroite, comparateur, profondeur);
+			nombre = nombreGauche;
+		}
+	}
+	TrierParInsertion(elements, nombre, comparateur);
+}
+
+/// <summary>
+/// Permet de placer  l'indice spcifi l'lment qui s'y trouverait si les lments spcifis taient tris, ceux qui le prcdent ne lui tant pas suprieurs et ceux qui le suivent ne lui tant pas infrieurs (slection introspective, en O(n) en moyenne et en O(n log n) dans tous les cas)
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage</param>
+/// <param name="nombre">Nombre d'lments de la plage</param>
+/// <param name="rang">Indice de l'lment  placer<para>Compris entre 0 et le nombre d'lments - 1</para></param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+template <class T, class C> void SelectionnerElement(T* elements, long nombre, long rang, const C& comparateur)
+{
+	int profondeur = 0;
+	for (long reste = nombre; reste > 1; reste >>= 1) profondeur += 2;
+	while (nombre > SeuilTriParInsertion)
+	{
+		if (profondeur == 0)
+		{
+			TrierParTas(elements, nombre, comparateur);
+			return;
+		}
+		profondeur--;
+		// Mme partition que TrierIntrospectif, seule la plage contenant le rang recherch tant ensuite poursuivie
+		long milieu = nombre / 2;
+		if (comparateur(elements[milieu], elements[0]) < 0) EchangerElements(elements[milieu], elements[0]);
+		if (comparateur(elements[nombre - 1], elements[milieu]) < 0)
+		{
+			EchangerElements(elements[nombre - 1], elements[milieu]);
+			if (comparateur(elements[milieu], elements[0]) < 0) EchangerElements(elements[milieu], elements[0]);
+		}
+		EchangerElements(elements[0], elements[milieu]);
+		T pivot = elements[0];
+		long gauche = 0;
+		long droite = nombre;
+		while (true)
+		{
+			do gauche++; while (comparateur(elements[gauche], pivot) < 0);
+			do droite--; while (comparateur(pivot, elements[droite]) < 0);
+			if (gauche >= droite) break;
+			EchangerElements(elements[gauche], elements[droite]);
+		}
+		EchangerElements(elements[0], elements[droite]);
+		if (rang == droite) return;
+		if (rang < droite)
+		{
+			nombre = droite;
+		}
+		else
+		{
+			elements += droite + 1;
+			nombre -= droite + 1;
+			rang -= droite + 1;
+		}
+	}
+	TrierParInsertion(elements, nombre, comparateur);
+}
+
+/// <summary>
+/// Permet de placer en tte, tris, les plus petits des lments spcifis, l'ordre des suivants tant indtermin (tri partiel par tas, en O(n log k))
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage</param>
+/// <param name="nombre">Nombre d'lments de la plage</param>
+/// <param name="nombreTries">Nombre d'lments  placer en tte</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+template <class T, class C> void TrierPartiellement(T* elements, long nombre, long nombreTries, const C& comparateur)
+{
+	if (nombreTries <= 0) return;
+	if (nombreTries >= nombre)
+	{
+		TrierIntrospectif(elements, nombre, comparateur);
+		return;
+	}
+	// Tas des plus petits lments rencontrs (le plus grand d'entre eux tant  la racine), que chaque lment suivant plus petit que la racine vient remplacer
+	for (long indice = nombreTries / 2 - 1; indice >= 0; indice--) TamiserTas(elements, indice, nombreTries, comparateur);
+	for (long indice = nombreTries; indice < nombre; indice++)
+	{
+		if (comparateur(elements[indice], elements[0]) >= 0) continue;
+		EchangerElements(elements[0], elements[indice]);
+		TamiserTas(elements, 0, nombreTries, comparateur);
+	}
+	for (long dernier = nombreTries - 1; dernier > 0; dernier--)
+	{
+		EchangerElements(elements[0], elements[dernier]);
+		TamiserTas(elements, 0, dernier, comparateur);
+	}
+}
+
+/// <summary>
+/// Permet de fusionner, de manire stable, deux plages tries en une seule
+/// <para>La destination peut recouvrir la seconde plage, pourvu qu'elle commence exactement "nombre" lments avant celle-ci</para>
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la premire plage</param>
+/// <param name="nombre">Nombre d'lments de la premire plage</param>
+/// <param name="autresElements">Adresse du premier lment de la seconde plage</param>
+/// <param name="autreNombre">Nombre d'lments de la seconde plage</param>
+/// <param name="destination">Adresse du premier lment de la plage de destination</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+template <class T, class C> void FusionnerPlages(const T* elements, long nombre, const T* autresElements, long autreNombre, T* destination, const C& comparateur)
+{
+	long indice = 0;
+	long autreIndice = 0;
+	// A galit, l'lment de la premire plage passe en premier, ce qui garantit la stabilit
+	while ((indice < nombre) && (autreIndice < autreNombre))
+	{
+		if (comparateur(autresElements[autreIndice], elements[indice]) < 0)
+		{
+			*(destination++) = autresElements[autreIndice++];
+		}
+		else
+		{
+			*(destination++) = elements[indice++];
+		}
+	}
+	while (indice < nombre) *(destination++) = elements[indice++];
+	while (autreIndice < autreNombre) *(destination++) = autresElements[autreIndice++];
+}
+
+/// <summary>
+/// Permet de fusionner, de manire stable et sur place, deux plages tries conscutives, la seconde tant pralablement recopie dans le tampon
+/// <para>La fusion se fait  partir de la fin : seuls les lments de la premire plage suprieurs au plus petit lment de la seconde sont dplacs</para>
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la premire plage</param>
+/// <param name="nombre">Nombre total d'lments des deux plages</param>
+/// <param name="milieu">Nombre d'lments de la premire plage</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+/// <param name="tampon">Adresse d'un tampon pouvant contenir les lments de la seconde plage</param>
+template <class T, class C> void FusionnerEnPlace(T* elements, long nombre, long milieu, const C& comparateur, T* tampon)
+{
+	long autreNombre = nombre - milieu;
+	for (long indice = 0; indice < autreNombre; indice++) tampon[indice] = elements[milieu + indice];
+	long indice = milieu - 1;
+	long autreIndice = autreNombre - 1;
+	long destination = nombre - 1;
+	// A galit, l'lment de la seconde plage est plac aprs celui de la premire, ce qui garantit la stabilit
+	while (autreIndice >= 0)
+	{
+		if ((indice >= 0) && (comparateur(tampon[autreIndice], elements[indice]) < 0))
+		{
+			elements[destination--] = elements[indice--];
+		}
+		else
+		{
+			elements[destination--] = tampon[autreIndice--];
+		}
+	}
+}
+
+/// <summary>
+/// Permet de trier par fusion (tri stable, en O(n log n) dans tous les cas) les lments spcifis
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage  trier</param>
+/// <param name="nombre">Nombre d'lments de la plage  trier</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+/// <param name="tampon">Adresse d'un tampon pouvant contenir au moins la moiti des lments de la plage</param>
+template <class T, class C> void TrierParFusion(T* elements, long nombre, const C& comparateur, T* tampon)
+{
+	if (nombre <= SeuilTriParInsertion)
+	{
+		TrierParInsertion(elements, nombre, comparateur);
+		return;
+	}
+	long milieu = nombre / 2;
+	TrierParFusion(elements, milieu, comparateur, tampon);
+	TrierParFusion(elements + milieu, nombre - milieu, comparateur, tampon);
+	// Les deux moitis dj dans l'ordre n'ont pas  tre fusionnes
+	if (comparateur(elements[milieu], elements[milieu - 1]) >= 0) return;
+	for (long indice = 0; indice < milieu; indice++) tampon[indice] = elements[indice];
+	FusionnerPlages(tampon, milieu, elements + milieu, nombre - milieu, elements, comparateur);
+}
+
+/// <summary>
+/// Dfinit une tche d'un tri parallle : tri d'une plage, ou fusion de deux plages tries (cf. TrierEnParallele)
+/// </summary>
+template <class T, class C> class CTacheTri
+{
+public:
+	/// <summary>
+	/// Fonction d'entre d'un fil d'excution de la tche spcifie
+	/// </summary>
+	/// <param name="tache">Adresse de la tche  excuter</param>
+	/// <returns>0</returns>
+	static DWORD WINAPI Executer(LPVOID tache)
+	{
+		((CTacheTri<T, C>*)tache)->Executer();
+		return 0;
+	}
+
+	/// <summary>
+	/// Permet d'excuter cette tche dans le fil d'excution courant
+	/// </summary>
+	void Executer()
+	{
+		if (m_AutresElements != NULL)
+		{
+			FusionnerPlages(m_Elements, m_Nombre, m_AutresElements, m_AutreNombre, m_Destination, *m_Comparateur);
+		}
+		else if (m_Stable)
+		{
+			TrierParFusion(m_Elements, m_Nombre, *m_Comparateur, m_Destination);
+		}
+		else
+		{
+			TrierIntrospectif(m_Elements, m_Nombre, *m_Comparateur);
+		}
+	}
+
+public:
+	/// <summary>
+	/// Membre contenant l'adresse de la plage  trier, sinon de la premire plage  fusionner
+	/// </summary>
+	T* m_Elements;
+
+	/// <summary>
+	/// Membre contenant le nombre d'lments de la plage  trier, sinon de la premire plage  fusionner
+	/// </summary>
+	long m_Nombre;
+
+	/// <summary>
+	/// Membre contenant l'adresse de la seconde plage  fusionner, sinon NULL pour une tche de tri
+	/// </summary>
+	T* m_AutresElements;
+
+	/// <summary>
+	/// Membre contenant le nombre d'lments de la seconde plage  fusionner
+	/// </summary>
+	long m_AutreNombre;
+
+	/// <summary>
+	/// Membre contenant l'adresse de la destination de la fusion, sinon du tampon du tri stable
+	/// </summary>
+	T* m_Destination;
+
+	/// <summary>
+	/// Membre indiquant si le tri de la plage doit tre stable
+	/// </summary>
+	bool m_Stable;
+
+	/// <summary>
+	/// Membre contenant l'adresse de l'objet comparateur
+	/// </summary>
+	const C* m_Comparateur;
+};
+
+/// <summary>
+/// Permet d'excuter simultanment les tches spcifies, chacune dans son propre fil d'excution (la dernire dans le fil courant)
+/// <para>Une tche dont le fil d'excution n'a pu tre cr est excute dans le fil courant</para>
+/// </summary>
+/// <param name="taches">Adresse de la premire tche</param>
+/// <param name="nombreTaches">Nombre de tches<para>Au plus MAXIMUM_WAIT_OBJECTS + 1</para></param>
+template <class T, class C> void ExecuterTachesTri(CTacheTri<T, C>* taches, long nombreTaches)
+{
+	HANDLE fils[MAXIMUM_WAIT_OBJECTS];
+	DWORD nombreFils = 0;
+	for (long indice = 0; indice < (nombreTaches - 1); indice++)
+	{
+		HANDLE fil = CreateThread(NULL, 0, CTacheTri<T, C>::Executer, taches + indice, 0, NULL);
+		if (fil != NULL)
+		{
+			fils[nombreFils++] = fil;
+		}
+		else
+		{
+			taches[indice].Executer();
+		}
+	}
+	if (nombreTaches >= 1) taches[nombreTaches - 1].Executer();
+	if (nombreFils == 0) return;
+	WaitForMultipleObjects(nombreFils, fils, TRUE, INFINITE);
+	for (DWORD indice = 0; indice < nombreFils; indice++) CloseHandle(fils[indice]);
+}
+
+/// <summary>
+/// Permet de trier en parallle les lments spcifis : chaque fil d'excution trie une plage contigu, puis les plages tries sont fusionnes deux  deux, elles aussi en parallle
+/// <para>En mode stable, le rsultat est identique  celui de TrierParFusion</para>
+/// </summary>
+/// <param name="elements">Adresse du premier lment de la plage  trier</param>
+/// <param name="nombre">Nombre d'lments de la plage  trier</param>
+/// <param name="comparateur">Objet comparateur (cf. TrierParInsertion)</param>
+/// <param name="stable">Indique si le tri doit tre stable</param>
+/// <param name="nombreFils">Nombre de fils d'excution  utiliser<para>Compris entre 2 et MAXIMUM_WAIT_OBJECTS</para></param>
+/// <param name="tampon">Adresse d'un tampon pouvant contenir tous les lments de la plage</param>
+/// <returns>Vrai si le tri a pu se faire, sinon faux (les lments sont alors laisss dans leur ordre initial)</returns>
+template <class T, class C> bool TrierEnParallele(T* elements, long nombre, const C& comparateur, bool stable, long nombreFils, T* tampon)
+{
+	if ((nombreFils < 2) || (nombreFils > MAXIMUM_WAIT_OBJECTS) || (nombre < nombreFils)) return false;
+	CTacheTri<T, C>* taches = (CTacheTri<T, C>*)malloc(nombreFils * sizeof(CTacheTri<T, C>));
+	if (taches == NULL) return false;
+	long* bornes = (long*)malloc((nombreFils + 1) * sizeof(long));
+	if (bornes == NULL)
+	{
+		free(taches);
+		return false;
+	}
+	// Tri en parallle de plages contigus de tailles gales ( un lment prs)
+	for (long indice = 0; indice <= nombreFils; indice++) bornes[indice] = (long)(((__int64)nombre * indice) / nombreFils);
+	for (long indice = 0; indice < nombreFils; indice++)
+	{
+		CTacheTri<T, C>& tache = taches[indice];
+		tache.m_Elements = elements + bornes[indice];
+		tache.m_Nombre = bornes[indice + 1] - bornes[indice];
+		tache.m_AutresElements = NULL;
+		tache.m_AutreNombre = 0;
+		tache.m_Destination = tampon + bornes[indice];
+		tache.m_Stable = stable;
+		tache.m_Comparateur = &comparateur;
+	}
+	ExecuterTachesTri(taches, nombreFils);
+	// Fusions en parallle des plages voisines deux  deux, en alternant entre les lments et le tampon, jusqu' n'avoir plus qu'une seule plage
+	T* source = elements;
+	T* destination = tampon;
+	long nombrePlages = nombreFils;
+	while (nombrePlages > 1)
+	{
+		long nombreTaches = 0;
+		for (long plage = 0; plage < nombrePlages; plage += 2)
+		{
+			CTacheTri<T, C>& tache = taches[nombreTaches++];
+			long debut = bornes[plage];
+			long milieu = bornes[plage + 1];
+			long fin = ((plage + 2) <= nombrePlages) ? bornes[plage + 2] : milieu;
+			// Une plage sans voisine est simplement recopie (fusion avec une plage vide)
+			tache.m_Elements = source + debut;
+			tache.m_Nombre = milieu - debut;
+			tache.m_AutresElements = source + milieu;
+			tache.m_AutreNombre = fin - milieu;
+			tache.m_Destination = destination + debut;
+			tache.m_Comparateur = &comparateur;
+			bornes[plage / 2] = debut;
+		}
+		bornes[nombreTaches] = nombre;
+		ExecuterTachesTri(taches, nombreTaches);
+		T* echange = source;
+		source = destination;
+		destination = echange;
+		nombrePlages = nombreTaches;
+	}
+	if (source != elements)
+	{
+		for (long indice = 0; indice < nombre; indice++) elements[indice] = source[indice];
+	}
+	free(bornes);
+	free(taches);
+	return true;
+}
+
+#endif//TRI_H